@@ -12,6 +12,22 @@
 #include "VRBaseCharacter.h"
 #include "VRRootComponent.h"
 #include "VRPlayerController.h"
+
+DEFINE_STAT(STAT_VRSavedMoveAllocations);
+DEFINE_STAT(STAT_VRMovementSweeps);
+DEFINE_STAT(STAT_VRMovementFloorTraces);
+DEFINE_STAT(STAT_VRMovementServerMoves);
+DEFINE_STAT(STAT_VRMovementClientMovesSent);
+DEFINE_STAT(STAT_VRMovementMoveActions);
+DEFINE_STAT(STAT_VRMovementServerMovePerform);
+DEFINE_STAT(STAT_VRMovementPhysWalking);
+DEFINE_STAT(STAT_VRMovementPhysFalling);
+DEFINE_STAT(STAT_VRMovementPhysNavWalking);
+DEFINE_STAT(STAT_VRMovementPhysClimbing);
+DEFINE_STAT(STAT_VRMovementPhysLowGrav);
+
+uint32 FVRMovementQueryCounters::Sweeps = 0;
+uint32 FVRMovementQueryCounters::FloorTraces = 0;
 	
 FSavedMove_VRBaseCharacter::FSavedMove_VRBaseCharacter() : FSavedMove_Character()
 {
@@ -101,6 +101,7 @@ UGripMotionControllerComponent::UGripMotionControllerComponent(const FObjectInit
 	bReppedOnce = false;
 	bOffsetByHMD = false;
 	bIsPostTeleport = false;
+	bIsHandlingGripArrays = false;
 
 	GripIDIncrementer = INVALID_VRGRIP_ID;
 
@@ -1084,37 +1085,31 @@ bool UGripMotionControllerComponent::GripObjectByInterface(UObject * ObjectToGri
 
 		if (PrimComp->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
 		{
-			EGripCollisionType CollisionType = IVRGripInterface::Execute_GetPrimaryGripType(PrimComp, bIsSlotGrip);
-
-			float Stiffness;
-			float Damping;
-			IVRGripInterface::Execute_GetGripStiffnessAndDamping(PrimComp, Stiffness, Damping);
+			FVRGripInterfaceSnapshot InterfaceSnapshot;
+			IVRGripInterface::GetGripInterfaceSnapshot(PrimComp, bIsSlotGrip, InterfaceSnapshot);
 
 			return GripComponent(PrimComp, WorldOffset, bWorldOffsetIsRelative, OptionalSnapToSocketName,
 				OptionalBoneToGripName,
-				CollisionType,
-				IVRGripInterface::Execute_GripLateUpdateSetting(PrimComp),
-				IVRGripInterface::Execute_GripMovementReplicationType(PrimComp),
-				Stiffness,
-				Damping,
+				InterfaceSnapshot.PrimaryGripType,
+				InterfaceSnapshot.LateUpdateSetting,
+				InterfaceSnapshot.MovementReplicationType,
+				InterfaceSnapshot.ConstraintStiffness,
+				InterfaceSnapshot.ConstraintDamping,
 				bIsSlotGrip
 				);
 		}
 		else if (Owner->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
 		{
-			EGripCollisionType CollisionType = IVRGripInterface::Execute_GetPrimaryGripType(Owner, bIsSlotGrip);
-
-			float Stiffness;
-			float Damping;
-			IVRGripInterface::Execute_GetGripStiffnessAndDamping(Owner, Stiffness, Damping);
+			FVRGripInterfaceSnapshot InterfaceSnapshot;
+			IVRGripInterface::GetGripInterfaceSnapshot(Owner, bIsSlotGrip, InterfaceSnapshot);
 
 			return GripComponent(PrimComp, WorldOffset, bWorldOffsetIsRelative, OptionalSnapToSocketName,
 				OptionalBoneToGripName,
-				CollisionType,
-				IVRGripInterface::Execute_GripLateUpdateSetting(Owner),
-				IVRGripInterface::Execute_GripMovementReplicationType(Owner),
-				Stiffness,
-				Damping,
+				InterfaceSnapshot.PrimaryGripType,
+				InterfaceSnapshot.LateUpdateSetting,
+				InterfaceSnapshot.MovementReplicationType,
+				InterfaceSnapshot.ConstraintStiffness,
+				InterfaceSnapshot.ConstraintDamping,
 				bIsSlotGrip
 				);
 		}
@@ -1134,37 +1129,31 @@ bool UGripMotionControllerComponent::GripObjectByInterface(UObject * ObjectToGri
 
 		if (root->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
 		{
-			EGripCollisionType CollisionType = IVRGripInterface::Execute_GetPrimaryGripType(root, bIsSlotGrip);
-
-			float Stiffness;
-			float Damping;
-			IVRGripInterface::Execute_GetGripStiffnessAndDamping(root, Stiffness, Damping);
+			FVRGripInterfaceSnapshot InterfaceSnapshot;
+			IVRGripInterface::GetGripInterfaceSnapshot(root, bIsSlotGrip, InterfaceSnapshot);
 
 			return GripActor(Actor, WorldOffset, bWorldOffsetIsRelative, OptionalSnapToSocketName,
 				OptionalBoneToGripName,
-				CollisionType,
-				IVRGripInterface::Execute_GripLateUpdateSetting(root),
-				IVRGripInterface::Execute_GripMovementReplicationType(root),
-				Stiffness,
-				Damping,
+				InterfaceSnapshot.PrimaryGripType,
+				InterfaceSnapshot.LateUpdateSetting,
+				InterfaceSnapshot.MovementReplicationType,
+				InterfaceSnapshot.ConstraintStiffness,
+				InterfaceSnapshot.ConstraintDamping,
 				bIsSlotGrip
 				);
 		}
 		else if (Actor->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
 		{
-			EGripCollisionType CollisionType = IVRGripInterface::Execute_GetPrimaryGripType(Actor, bIsSlotGrip);
-
-			float Stiffness;
-			float Damping;
-			IVRGripInterface::Execute_GetGripStiffnessAndDamping(Actor, Stiffness, Damping);
+			FVRGripInterfaceSnapshot InterfaceSnapshot;
+			IVRGripInterface::GetGripInterfaceSnapshot(Actor, bIsSlotGrip, InterfaceSnapshot);
 
 			return GripActor(Actor, WorldOffset, bWorldOffsetIsRelative, OptionalSnapToSocketName,
 				OptionalBoneToGripName,
-				CollisionType,
-				IVRGripInterface::Execute_GripLateUpdateSetting(Actor),
-				IVRGripInterface::Execute_GripMovementReplicationType(Actor),
-				Stiffness,
-				Damping,
+				InterfaceSnapshot.PrimaryGripType,
+				InterfaceSnapshot.LateUpdateSetting,
+				InterfaceSnapshot.MovementReplicationType,
+				InterfaceSnapshot.ConstraintStiffness,
+				InterfaceSnapshot.ConstraintDamping,
 				bIsSlotGrip
 				);
 		}
@@ -1334,7 +1323,8 @@ bool UGripMotionControllerComponent::GripActor(
 			}
 		}
 
-		AdvancedGripSettings = IVRGripInterface::Execute_AdvancedGripSettings(root);
+		FVRGripInterfaceSnapshot InterfaceSnapshot;
+		AdvancedGripSettings = IVRGripInterface::TryGetNativeGripInterfaceSnapshot(root, bIsSlotGrip, InterfaceSnapshot) ? InterfaceSnapshot.GetAdvancedGripSettings() : IVRGripInterface::Execute_AdvancedGripSettings(root);
 		ObjectToCheck = root;
 	}
 	else if (ActorToGrip->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
@@ -1364,7 +1354,8 @@ bool UGripMotionControllerComponent::GripActor(
 			}
 		}
 
-		AdvancedGripSettings = IVRGripInterface::Execute_AdvancedGripSettings(ActorToGrip);
+		FVRGripInterfaceSnapshot InterfaceSnapshot;
+		AdvancedGripSettings = IVRGripInterface::TryGetNativeGripInterfaceSnapshot(ActorToGrip, bIsSlotGrip, InterfaceSnapshot) ? InterfaceSnapshot.GetAdvancedGripSettings() : IVRGripInterface::Execute_AdvancedGripSettings(ActorToGrip);
 		ObjectToCheck = ActorToGrip;
 	}
 
@@ -1604,7 +1595,8 @@ bool UGripMotionControllerComponent::GripComponent(
 		}
 		
 
-		AdvancedGripSettings = IVRGripInterface::Execute_AdvancedGripSettings(ComponentToGrip);
+		FVRGripInterfaceSnapshot InterfaceSnapshot;
+		AdvancedGripSettings = IVRGripInterface::TryGetNativeGripInterfaceSnapshot(ComponentToGrip, bIsSlotGrip, InterfaceSnapshot) ? InterfaceSnapshot.GetAdvancedGripSettings() : IVRGripInterface::Execute_AdvancedGripSettings(ComponentToGrip);
 		ObjectToCheck = ComponentToGrip;
 	}
 
@@ -2222,6 +2214,7 @@ void UGripMotionControllerComponent::DropAndSocket_Implementation(const FBPActor
 	bool bIsHeld = false;
 
 	DestroyPhysicsHandle(NewDrop);
+	RemoveGripScriptPlan(NewDrop.GripID);
 
 	bool bHadGripAuthority = HasGripAuthority(NewDrop);
 
@@ -2786,6 +2779,7 @@ void UGripMotionControllerComponent::Drop_Implementation(const FBPActorGripInfor
 	}
 
 	DestroyPhysicsHandle(NewDrop, bHadAnotherSelfGrip);
+	RemoveGripScriptPlan(NewDrop.GripID);
 
 	bool bHadGripAuthority = HasGripAuthority(NewDrop);
 
@@ -3980,57 +3974,93 @@ void UGripMotionControllerComponent::TickComponent(float DeltaTime, enum ELevelT
 }
 
 bool UGripMotionControllerComponent::GetGripWorldTransform(TArray<UVRGripScriptBase*>& GripScripts, float DeltaTime, FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport, bool &bForceADrop)
+{
+	// One off calls (teleports) just compile a temporary plan
+	FVRGripScriptExecutionPlan GripScriptPlan;
+	GripScriptPlan.Scripts.Append(GripScripts);
+	GripScriptPlan.Rebuild();
+
+	return GetGripWorldTransform(GripScriptPlan, DeltaTime, WorldTransform, ParentTransform, Grip, actor, root, bRootHasInterface, bActorHasInterface, bIsForTeleport, bForceADrop);
+}
+
+bool UGripMotionControllerComponent::GetGripWorldTransform(FVRGripScriptExecutionPlan& GripScriptPlan, float DeltaTime, FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport, bool &bForceADrop)
 {
 	SCOPE_CYCLE_COUNTER(STAT_GetGripTransform);
 
 	bool bHasValidTransform = true;
 
-	if (GripScripts.Num())
+	// If none of the scripts override the base transform
+	if (!GripScriptPlan.bOverridesDefaultTransform && DefaultGripScript)
+	{
+		bHasValidTransform = DefaultGripScript->CallCorrect_GetWorldTransform(this, DeltaTime, WorldTransform, ParentTransform, Grip, actor, root, bRootHasInterface, bActorHasInterface, bIsForTeleport);
+		bForceADrop = DefaultGripScript->Wants_ToForceDrop();
+	}
+
+	// Run the active overriding and modifying scripts in order
+	for (const FVRGripScriptExecutionPlan::FStep& Step : GripScriptPlan.TransformSteps)
+	{
+		UVRGripScriptBase* Script = Step.Script.Get();
+
+		// An earlier script may have deactivated this one this frame
+		if (!Script || !Script->bIsActive)
+			continue;
+
+		bHasValidTransform = Script->CallCorrect_GetWorldTransform(this, DeltaTime, WorldTransform, ParentTransform, Grip, actor, root, bRootHasInterface, bActorHasInterface, bIsForTeleport);
+		bForceADrop = Script->Wants_ToForceDrop();
+
+		// Early out, one of the scripts is telling us that the transform isn't valid, something went wrong or the grip is flagged for drop
+		if (!bHasValidTransform || bForceADrop)
+			break;
+	}
+
+	return bHasValidTransform;
+}
+
+FVRGripScriptExecutionPlan& UGripMotionControllerComponent::GetGripScriptPlan(uint8 GripID, UObject* InterfaceObject)
+{
+	FVRGripScriptExecutionPlan& GripScriptPlan = GripScriptPlans.FindOrAdd(GripID);
+
+	if (!GripScriptPlan.bHasGatheredScripts || GripScriptPlan.GrippedObject.Get() != InterfaceObject || GripScriptPlan.HasStaleScripts())
 	{
-		bool bGetDefaultTransform = true;
+		GripScriptPlan.Scripts.Reset();
 
-		// Get grip script world transform overrides (if there are any)
-		for (UVRGripScriptBase* Script: GripScripts)
+		if (InterfaceObject)
 		{
-			if (Script && Script->IsScriptActive() && Script->GetWorldTransformOverrideType() == EGSTransformOverrideType::OverridesWorldTransform)
-			{
-				// One of the grip scripts overrides the default transform
-				bGetDefaultTransform = false;
-				break;
-			}
+			TArray<UVRGripScriptBase*> GatheredScripts;
+			IVRGripInterface::Execute_GetGripScripts(InterfaceObject, GatheredScripts);
+			GripScriptPlan.Scripts.Append(GatheredScripts);
 		}
 
-		// If none of the scripts override the base transform
-		if (bGetDefaultTransform && DefaultGripScript)
-		{		
-			bHasValidTransform = DefaultGripScript->CallCorrect_GetWorldTransform(this, DeltaTime, WorldTransform, ParentTransform, Grip, actor, root, bRootHasInterface, bActorHasInterface, bIsForTeleport);
-			bForceADrop = DefaultGripScript->Wants_ToForceDrop();
-		}
+		GripScriptPlan.GrippedObject = InterfaceObject;
+		GripScriptPlan.bHasGatheredScripts = true;
+		GripScriptPlan.Rebuild();
+	}
+	else
+	{
+		GripScriptPlan.Refresh();
+	}
 
-		// Get grip script world transform modifiers (if there are any)
-		for (UVRGripScriptBase* Script : GripScripts)
-		{
-			if (Script && Script->IsScriptActive() && Script->GetWorldTransformOverrideType() != EGSTransformOverrideType::None)
-			{
-				bHasValidTransform = Script->CallCorrect_GetWorldTransform(this, DeltaTime, WorldTransform, ParentTransform, Grip, actor, root, bRootHasInterface, bActorHasInterface, bIsForTeleport);
-				bForceADrop = Script->Wants_ToForceDrop();
+	return GripScriptPlan;
+}
 
-				// Early out, one of the scripts is telling us that the transform isn't valid, something went wrong or the grip is flagged for drop
-				if (!bHasValidTransform || bForceADrop)
-					break;
-			}
-		}
+void UGripMotionControllerComponent::RemoveGripScriptPlan(uint8 GripID)
+{
+	if (bIsHandlingGripArrays)
+	{
+		PendingGripScriptPlanRemovals.AddUnique(GripID);
 	}
 	else
 	{
-		if (DefaultGripScript)
-		{
-			bHasValidTransform = DefaultGripScript->CallCorrect_GetWorldTransform(this, DeltaTime, WorldTransform, ParentTransform, Grip, actor, root, bRootHasInterface, bActorHasInterface, bIsForTeleport);
-			bForceADrop = DefaultGripScript->Wants_ToForceDrop();
-		}
+		GripScriptPlans.Remove(GripID);
 	}
+}
 
-	return bHasValidTransform;
+void UGripMotionControllerComponent::InvalidateGripScriptPlans()
+{
+	for (TPair<uint8, FVRGripScriptExecutionPlan>& PlanPair : GripScriptPlans)
+	{
+		PlanPair.Value.bHasGatheredScripts = false;
+	}
 }
 
 void UGripMotionControllerComponent::TickGrip(float DeltaTime)
@@ -4052,8 +4082,17 @@ void UGripMotionControllerComponent::TickGrip(float DeltaTime)
 		CheckTransactionBuffer();
 
 	// Split into separate functions so that I didn't have to combine arrays since I have some removal going on
+	// Plans of grips dropped during this are held until both arrays are done, the loops keep references into them
+	bIsHandlingGripArrays = true;
 	HandleGripArray(GrippedObjects, ParentTransform, DeltaTime, true);
 	HandleGripArray(LocallyGrippedObjects, ParentTransform, DeltaTime);
+	bIsHandlingGripArrays = false;
+
+	for (uint8 DroppedGripID : PendingGripScriptPlanRemovals)
+	{
+		GripScriptPlans.Remove(DroppedGripID);
+	}
+	PendingGripScriptPlanRemovals.Reset();
 
 	// Empty out the teleport flag
 	bIsPostTeleport = false;
@@ -4182,22 +4221,14 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 
 				bool bRescalePhysicsGrips = false;
 				
-				TArray<UVRGripScriptBase*> GripScripts;
-
-				if (bRootHasInterface)
-				{
-					IVRGripInterface::Execute_GetGripScripts(root, GripScripts);
-				}
-				else if (bActorHasInterface)
-				{
-					IVRGripInterface::Execute_GetGripScripts(actor, GripScripts);
-				}
-
+				UObject* InterfaceObject = bRootHasInterface ? (UObject*)root : (bActorHasInterface ? (UObject*)actor : nullptr);
+				FVRGripScriptExecutionPlan& GripScriptPlan = GetGripScriptPlan(Grip->GripID, InterfaceObject);
+				const TArray<TWeakObjectPtr<UVRGripScriptBase>>& GripScripts = GripScriptPlan.Scripts;
 
 				bool bForceADrop = false;
 
 				// Get the world transform for this grip after handling secondary grips and interaction differences
-				bool bHasValidWorldTransform = GetGripWorldTransform(GripScripts, DeltaTime, WorldTransform, ParentTransform, *Grip, actor, root, bRootHasInterface, bActorHasInterface, false, bForceADrop);
+				bool bHasValidWorldTransform = GetGripWorldTransform(GripScriptPlan, DeltaTime, WorldTransform, ParentTransform, *Grip, actor, root, bRootHasInterface, bActorHasInterface, false, bForceADrop);
 
 				// If a script or behavior is telling us to skip this and continue on (IE: it dropped the grip)
 				if (bForceADrop)
@@ -4227,8 +4258,9 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 				{
 
 					bool bSkipTeleport = false;
-					for (UVRGripScriptBase* Script : GripScripts)
+					for (const TWeakObjectPtr<UVRGripScriptBase>& ScriptPtr : GripScripts)
 					{
+						UVRGripScriptBase* Script = ScriptPtr.Get();
 						if (Script && Script->IsScriptActive() && Script->Wants_DenyTeleport(this))
 						{
 							bSkipTeleport = true;
@@ -4270,14 +4302,15 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 					else
 					{
 						float BreakDistance = 0.0f;
+						FVRGripInterfaceSnapshot InterfaceSnapshot;
 						if (bRootHasInterface)
 						{
-							BreakDistance = IVRGripInterface::Execute_GripBreakDistance(root);
+							BreakDistance = IVRGripInterface::TryGetNativeGripInterfaceSnapshot(root, Grip->bIsSlotGrip, InterfaceSnapshot) ? InterfaceSnapshot.ConstraintBreakDistance : IVRGripInterface::Execute_GripBreakDistance(root);
 						}
 						else if (bActorHasInterface)
 						{
 							// Actor grip interface is checked after component
-							BreakDistance = IVRGripInterface::Execute_GripBreakDistance(actor);
+							BreakDistance = IVRGripInterface::TryGetNativeGripInterfaceSnapshot(actor, Grip->bIsSlotGrip, InterfaceSnapshot) ? InterfaceSnapshot.ConstraintBreakDistance : IVRGripInterface::Execute_GripBreakDistance(actor);
 						}
 
 						FVector CheckDistance;
@@ -4294,8 +4327,9 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 							if (Grip->GripDistance >= BreakDistance)
 							{
 								bool bIgnoreDrop = false;
-								for (UVRGripScriptBase* Script : GripScripts)
+								for (const TWeakObjectPtr<UVRGripScriptBase>& ScriptPtr : GripScripts)
 								{
+									UVRGripScriptBase* Script = ScriptPtr.Get();
 									if (Script && Script->IsScriptActive() && Script->Wants_DenyAutoDrop())
 									{
 										bIgnoreDrop = true;
@@ -4508,7 +4542,9 @@ void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformat
 						{
 							root->SetSimulatePhysics(true);
 
-							SetUpPhysicsHandle(*Grip, &GripScripts);
+							TArray<UVRGripScriptBase*> HandleGripScripts;
+							GripScriptPlan.GetScripts(HandleGripScripts);
+							SetUpPhysicsHandle(*Grip, &HandleGripScripts);
 							UpdatePhysicsHandleTransform(*Grip, WorldTransform);
 							if (bRescalePhysicsGrips)
 								root->SetWorldScale3D(WorldTransform.GetScale3D());
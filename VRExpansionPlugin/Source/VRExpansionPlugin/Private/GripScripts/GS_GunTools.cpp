@@ -7,6 +7,7 @@
 #include "IXRTrackingSystem.h"
 #include "VRGlobalSettings.h"
 #include "VRBaseCharacter.h"
+#include "Misc/VREuroFilterSubsystem.h"
 #include "DrawDebugHelpers.h"
 
 UGS_GunTools::UGS_GunTools(const FObjectInitializer& ObjectInitializer) :
@@ -29,8 +30,12 @@ UGS_GunTools::UGS_GunTools(const FObjectInitializer& ObjectInitializer) :
 	bHasActiveRecoil = false;
 	DecayRate = 20.f;
 	LerpRate = 30.f;
+	RecoilFixedTimeStep = 1.f / 120.f;
 
 	BackEndRecoilStorage = FTransform::Identity;
+	BackEndRecoilTarget = FTransform::Identity;
+	PreviousRecoilStorage = FTransform::Identity;
+	RecoilTimeAccumulator = 0.f;
 
 	bUseGlobalVirtualStockSettings = true;
 
@@ -127,23 +132,16 @@ bool UGS_GunTools::GetWorldTransform_Implementation
 	}*/
 
 	// Just simple transform setting
+	FTransform CurrentRecoil = FTransform::Identity;
 	if (bHasRecoil && bHasActiveRecoil)
 	{
-		BackEndRecoilStorage.Blend(BackEndRecoilStorage, BackEndRecoilTarget, FMath::Clamp(LerpRate * DeltaTime, 0.f, 1.f));
-		BackEndRecoilTarget.Blend(BackEndRecoilTarget, FTransform::Identity, FMath::Clamp(DecayRate * DeltaTime, 0.f, 1.f));
-		bHasActiveRecoil = !BackEndRecoilTarget.Equals(FTransform::Identity);
-
-		if (!bHasActiveRecoil)
-		{
-			BackEndRecoilStorage.SetIdentity();
-			BackEndRecoilTarget.SetIdentity();
-		}		
+		UpdateRecoil(DeltaTime, CurrentRecoil);
 	}
 
 	if (bHasActiveRecoil)
 	{
 		// Eventually may want to adjust the pivot of the recoil rotation by the PivotOffset vector...
-		WorldTransform = BackEndRecoilStorage * Grip.RelativeTransform * Grip.AdditionTransform * ParentTransform;
+		WorldTransform = CurrentRecoil * Grip.RelativeTransform * Grip.AdditionTransform * ParentTransform;
 	}
 	else
 		WorldTransform = Grip.RelativeTransform * Grip.AdditionTransform * ParentTransform;
@@ -191,7 +189,7 @@ bool UGS_GunTools::GetWorldTransform_Implementation
 
 				if (!bIsMounted)
 				{
-					VirtualStockSettings.StockHandSmoothing.ResetSmoothingFilter();
+					ResetBankedSmoothing(StockHandFilterHandle, VirtualStockSettings.StockHandSmoothing);
 					
 					// Mount up
 					bIsMounted = true;
@@ -224,7 +222,7 @@ bool UGS_GunTools::GetWorldTransform_Implementation
 
 			if (bIsMounted && VirtualStockSettings.bSmoothStockHand)
 			{
-				FVector smoothedTrans = FMath::Lerp(WorldTransform.GetTranslation(), VirtualStockSettings.StockHandSmoothing.RunFilterSmoothing(WorldTransform.GetTranslation(), DeltaTime), VirtualStockSettings.SmoothingValueForStock);
+				FVector smoothedTrans = FMath::Lerp(WorldTransform.GetTranslation(), RunBankedSmoothing(StockHandFilterHandle, VirtualStockSettings.StockHandSmoothing, WorldTransform.GetTranslation(), DeltaTime), VirtualStockSettings.SmoothingValueForStock);
 				WorldTransform.SetTranslation(smoothedTrans);
 
 			}
@@ -479,7 +477,7 @@ void UGS_GunTools::OnGrip_Implementation(UGripMotionControllerComponent * Grippi
 			AdvSecondarySettings.SecondarySmoothing.MinCutoff = VRSettings.OneEuroMinCutoff;
 		}
 
-		AdvSecondarySettings.SecondarySmoothing.ResetSmoothingFilter();
+		ResetBankedSmoothing(SecondaryFilterHandle, AdvSecondarySettings.SecondarySmoothing);
 	}
 
 	if (bUseVirtualStock)
@@ -532,17 +530,120 @@ void UGS_GunTools::OnSecondaryGrip_Implementation(UGripMotionControllerComponent
 			AdvSecondarySettings.SecondarySmoothing.MinCutoff = VRSettings.OneEuroMinCutoff;
 		}
 
-		AdvSecondarySettings.SecondarySmoothing.ResetSmoothingFilter();
+		ResetBankedSmoothing(SecondaryFilterHandle, AdvSecondarySettings.SecondarySmoothing);
 	}
 
 	if (bUseVirtualStock)
 		ResetStockVariables();
 }
 
+void UGS_GunTools::OnGripRelease_Implementation(UGripMotionControllerComponent * ReleasingController, const FBPActorGripInformation & GripInformation, bool bWasSocketed)
+{
+	// Super doesn't do anything on grip release
+	ReleaseBankedSmoothing();
+}
+
+void UGS_GunTools::OnEndPlay_Implementation(const EEndPlayReason::Type EndPlayReason)
+{
+	// Grip base has no super of this
+	ReleaseBankedSmoothing();
+}
+
+FVector UGS_GunTools::RunBankedSmoothing(FVREuroFilterHandle& Handle, FBPEuroLowPassFilter& Filter, const FVector& InRawValue, float DeltaTime)
+{
+	UVREuroFilterSubsystem* Subsystem = FilterSubsystem.Get();
+
+	if (!Subsystem)
+	{
+		// Any handles we had belonged to a bank that is gone now
+		StockHandFilterHandle = FVREuroFilterHandle();
+		SecondaryFilterHandle = FVREuroFilterHandle();
+
+		UWorld* World = GetWorld();
+		Subsystem = World ? World->GetSubsystem<UVREuroFilterSubsystem>() : nullptr;
+
+		if (!Subsystem)
+			return Filter.RunFilterSmoothing(InRawValue, DeltaTime);
+
+		FilterSubsystem = Subsystem;
+	}
+
+	if (!Handle.IsValid())
+	{
+		Handle = Subsystem->RegisterFilter(Filter);
+	}
+
+	FVREuroLowPassFilterBank& FilterBank = Subsystem->GetFilterBank();
+	FilterBank.SetFilterInput(Handle, InRawValue);
+	return FilterBank.GetFilterOutput(Handle);
+}
+
+void UGS_GunTools::ResetBankedSmoothing(FVREuroFilterHandle& Handle, FBPEuroLowPassFilter& Filter)
+{
+	Filter.ResetSmoothingFilter();
+
+	if (UVREuroFilterSubsystem* Subsystem = FilterSubsystem.Get())
+	{
+		if (Handle.IsValid())
+		{
+			// Settings may have been reloaded from the globals since it was registered
+			Subsystem->GetFilterBank().SetFilterSettings(Handle, Filter);
+			Subsystem->GetFilterBank().ResetFilter(Handle);
+		}
+	}
+}
+
+void UGS_GunTools::ReleaseBankedSmoothing()
+{
+	if (UVREuroFilterSubsystem* Subsystem = FilterSubsystem.Get())
+	{
+		Subsystem->UnregisterFilter(StockHandFilterHandle);
+		Subsystem->UnregisterFilter(SecondaryFilterHandle);
+	}
+
+	StockHandFilterHandle = FVREuroFilterHandle();
+	SecondaryFilterHandle = FVREuroFilterHandle();
+}
+
 void UGS_GunTools::ResetRecoil()
 {
 	BackEndRecoilStorage = FTransform::Identity;
 	BackEndRecoilTarget = FTransform::Identity;
+	PreviousRecoilStorage = FTransform::Identity;
+	RecoilTimeAccumulator = 0.f;
+	bHasActiveRecoil = false;
+}
+
+void UGS_GunTools::StepRecoil(float StepTime)
+{
+	PreviousRecoilStorage = BackEndRecoilStorage;
+	BackEndRecoilStorage.Blend(BackEndRecoilStorage, BackEndRecoilTarget, FMath::Clamp(LerpRate * StepTime, 0.f, 1.f));
+	BackEndRecoilTarget.Blend(BackEndRecoilTarget, FTransform::Identity, FMath::Clamp(DecayRate * StepTime, 0.f, 1.f));
+}
+
+void UGS_GunTools::UpdateRecoil(float DeltaTime, FTransform & OutRecoil)
+{
+	const float StepTime = FMath::Max(RecoilFixedTimeStep, KINDA_SMALL_NUMBER);
+
+	// Cap the catch up so a hitch doesn't make us spin through hundreds of steps
+	const int32 MaxRecoilSteps = 16;
+	RecoilTimeAccumulator = FMath::Min(RecoilTimeAccumulator + DeltaTime, StepTime * MaxRecoilSteps);
+
+	while (RecoilTimeAccumulator >= StepTime)
+	{
+		StepRecoil(StepTime);
+		RecoilTimeAccumulator -= StepTime;
+	}
+
+	// Sleep once both the target and what we are showing have settled back to the baseline
+	if (BackEndRecoilTarget.Equals(FTransform::Identity) && BackEndRecoilStorage.Equals(FTransform::Identity))
+	{
+		ResetRecoil();
+		OutRecoil = FTransform::Identity;
+		return;
+	}
+
+	OutRecoil.Blend(PreviousRecoilStorage, BackEndRecoilStorage, RecoilTimeAccumulator / StepTime);
 }
 
 void UGS_GunTools::AddRecoilInstance(const FTransform & RecoilAddition, FVector Optional_Location)
@@ -584,6 +685,13 @@ void UGS_GunTools::AddRecoilInstance(const FTransform & RecoilAddition, FVector
 
 		BackEndRecoilTarget.SetRotation(curRot.Quaternion());
 
+		if (!bHasActiveRecoil)
+		{
+			// Waking up from sleep, start a fresh step
+			PreviousRecoilStorage = BackEndRecoilStorage;
+			RecoilTimeAccumulator = 0.f;
+		}
+
 		bHasActiveRecoil = !BackEndRecoilTarget.Equals(FTransform::Identity);
 	}
 }
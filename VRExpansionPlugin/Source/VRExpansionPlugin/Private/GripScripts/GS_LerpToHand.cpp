@@ -18,11 +18,45 @@ UGS_LerpToHand::UGS_LerpToHand(const FObjectInitializer& ObjectInitializer) :
 	CurrentLerpTime = 0.0f;
 	OnGripTransform = FTransform::Identity;
 	bUseCurve = false;
+	CurveCacheResolution = 64;
+	CachedCurveResolution = INDEX_NONE;
 	MinDistanceForLerp = 0.0f;
 	MinSpeedForLerp = 0.f;
 	MaxSpeedForLerp = 0.f;
 }
 
+void UGS_LerpToHand::RefreshCurveCache()
+{
+	CachedCurveSamples.Reset();
+	CachedCurveResolution = CurveCacheResolution;
+
+	FRichCurve * RichCurve = OptionalCurveToFollow.GetRichCurve();
+	if (!RichCurve || CurveCacheResolution <= 0)
+		return;
+
+	CachedCurveSamples.SetNumUninitialized(CurveCacheResolution + 1);
+
+	for (int32 i = 0; i <= CurveCacheResolution; ++i)
+	{
+		CachedCurveSamples[i] = RichCurve->Eval((float)i / (float)CurveCacheResolution);
+	}
+}
+
+float UGS_LerpToHand::EvaluateCurve(FRichCurve * RichCurve, float Alpha) const
+{
+	if (CachedCurveSamples.Num() < 2)
+		return RichCurve->Eval(Alpha);
+
+	// Return the end sample exactly, the lerp can land just short of it and then the finish check never fires
+	if (Alpha >= 1.0f)
+		return CachedCurveSamples.Last();
+
+	const float SamplePos = Alpha * (CachedCurveSamples.Num() - 1);
+	const int32 Index = FMath::Clamp(FMath::FloorToInt(SamplePos), 0, CachedCurveSamples.Num() - 2);
+
+	return FMath::Lerp(CachedCurveSamples[Index], CachedCurveSamples[Index + 1], SamplePos - Index);
+}
+
 //void UGS_InteractibleSettings::BeginPlay_Implementation() {}
 void UGS_LerpToHand::OnGrip_Implementation(UGripMotionControllerComponent * GrippingController, const FBPActorGripInformation & GripInformation) 
 {
@@ -60,6 +94,10 @@ void UGS_LerpToHand::OnGrip_Implementation(UGripMotionControllerComponent * Grip
 		OnLerpToHandBegin.Broadcast();
 	}
 
+	if (bUseCurve && CachedCurveResolution != CurveCacheResolution)
+	{
+		RefreshCurveCache();
+	}
 
 
 	bIsActive = true;
@@ -114,7 +152,7 @@ bool UGS_LerpToHand::GetWorldTransform_Implementation
 			}
 			else*/
 			{
-				Alpha = FMath::Clamp(richCurve->Eval(Alpha), 0.f, 1.f);
+				Alpha = FMath::Clamp(EvaluateCurve(richCurve, Alpha), 0.f, 1.f);
 				//CurrentLerpTime += DeltaTime;
 			}
 		}
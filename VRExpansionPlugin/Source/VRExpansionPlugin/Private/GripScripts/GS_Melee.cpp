@@ -32,9 +32,21 @@ UGS_Melee::UGS_Melee(const FObjectInitializer& ObjectInitializer) :
 
 	//bCanEverTick = true;
 	bCheckLodge = false;
-	bCanEverTick = false;
+
+	// Only ticks when swept hit detection is on
+	bCanEverTick = true;
+	bAllowTicking = false;
+	bUseSweptHitDetection = false;
+	SweptHitSubSteps = 2;
+	SweptHitImpulseScaler = 1.0f;
+	LastSweptParentTransform = FTransform::Identity;
+	bHasLastSweptParentTransform = false;
 	bAlwaysTickPenetration = true;
 	COMType = EVRMeleeComType::VRPMELEECOM_BetweenHands;
+	COMUpdateTolerance = 0.1f;
+	LastComLocation = FVector::ZeroVector;
+	bHasLastComLocation = false;
+	LastComWriteFrame = 0;
 	bSkipGripMassChecks = true;
 	bOnlyPenetrateWithTwoHands = false;
 }
@@ -203,8 +215,13 @@ void UGS_Melee::UpdateHandPositionAndRotation(FBPGripPair HandPair, FTransform H
 				RelativeTrans.SetRotation(orientationRot.Inverse() * currentRot.Quaternion());
 			}
 
-			GripInfo->RelativeTransform = RelativeTrans.Inverse();
-			HandPair.HoldingController->UpdatePhysicsHandle(*GripInfo, true);
+			// The grips relative transform is the last slot we set, only rebuild the handle if the hand actually slid
+			const FTransform NewRelativeTransform = RelativeTrans.Inverse();
+			if (!NewRelativeTransform.Equals(GripInfo->RelativeTransform))
+			{
+				GripInfo->RelativeTransform = NewRelativeTransform;
+				HandPair.HoldingController->UpdatePhysicsHandle(*GripInfo, true);
+			}
 
 			LocDifference = RelativeTrans.GetLocation() - OriginalLoc;
 			RotDifference = RelativeTrans.GetRotation().Rotator().Roll - OriginalRot.Rotator().Roll;
@@ -290,8 +307,14 @@ void UGS_Melee::UpdateHandPosition(FBPGripPair HandPair, FVector HandWorldPositi
 			currentLoc.X = currentRelVec.X;
 
 			RelativeTrans.SetLocation(orientationRot.UnrotateVector(currentLoc));
-			GripInfo->RelativeTransform = RelativeTrans.Inverse();
-			HandPair.HoldingController->UpdatePhysicsHandle(*GripInfo, true);
+
+			// The grips relative transform is the last slot we set, only rebuild the handle if the hand actually slid
+			const FTransform NewRelativeTransform = RelativeTrans.Inverse();
+			if (!NewRelativeTransform.Equals(GripInfo->RelativeTransform))
+			{
+				GripInfo->RelativeTransform = NewRelativeTransform;
+				HandPair.HoldingController->UpdatePhysicsHandle(*GripInfo, true);
+			}
 
 			LocDifference = RelativeTrans.GetLocation() - OriginalLoc;
 
@@ -376,6 +399,7 @@ void UGS_Melee::OnGrip_Implementation(UGripMotionControllerComponent* GrippingCo
 	// This lets us change the grip settings prior to actually starting the grip off
 	//SetTickEnabled(true);
 	bCheckLodge = true;
+	UpdateSweptHitTicking();
 
 	//if (GrippingController->HasGripAuthority(GripInformation))
 	{
@@ -433,12 +457,17 @@ void UGS_Melee::OnGripRelease_Implementation(UGripMotionControllerComponent* Rel
 	if (!bIsActive)
 		return;
 
+	// The remaining hands handle gets rebuilt, make sure its com is written out again
+	InvalidateComCache();
+
 	//if(!bAlwaysTickPenetration)
 		//SetTickEnabled(false);
 
 	if (!bAlwaysTickPenetration)
 		bCheckLodge = false;
 
+	UpdateSweptHitTicking();
+
 	if (SecondaryHand.IsValid() && SecondaryHand.HoldingController == ReleasingController && SecondaryHand.GripID == GripInformation.GripID)
 	{
 		SecondaryHand = FBPGripPair();
@@ -495,8 +524,16 @@ void UGS_Melee::OnGripRelease_Implementation(UGripMotionControllerComponent* Rel
 					HandleInfo->AngConstraint.SlerpDrive.Stiffness = GripInfo->Stiffness * 1.5f;
 				}
 
-				FBPAdvGripSettings AdvSettings = IVRGripInterface::Execute_AdvancedGripSettings(GripInfo->GrippedObject);
-				GripInfo->AdvancedGripSettings.PhysicsSettings.PhysicsGripLocationSettings = AdvSettings.PhysicsSettings.PhysicsGripLocationSettings;
+				FVRGripInterfaceSnapshot InterfaceSnapshot;
+				if (IVRGripInterface::TryGetNativeGripInterfaceSnapshot(GripInfo->GrippedObject, GripInfo->bIsSlotGrip, InterfaceSnapshot))
+				{
+					GripInfo->AdvancedGripSettings.PhysicsSettings.PhysicsGripLocationSettings = InterfaceSnapshot.GetAdvancedGripSettings().PhysicsSettings.PhysicsGripLocationSettings;
+				}
+				else
+				{
+					FBPAdvGripSettings AdvSettings = IVRGripInterface::Execute_AdvancedGripSettings(GripInfo->GrippedObject);
+					GripInfo->AdvancedGripSettings.PhysicsSettings.PhysicsGripLocationSettings = AdvSettings.PhysicsSettings.PhysicsGripLocationSettings;
+				}
 
 				PrimaryHand.HoldingController->UpdatePhysicsHandle(PrimaryHand.GripID, true);
 			}
@@ -505,10 +542,25 @@ void UGS_Melee::OnGripRelease_Implementation(UGripMotionControllerComponent* Rel
 
 }
 
+void UGS_Melee::RebuildSurfaceLookupTable()
+{
+	OverrideSurfaceLookupTable.Build(OverrideMeleeSurfaceSettings);
+}
+
 void UGS_Melee::OnBeginPlay_Implementation(UObject * CallingOwner)
 {
 	// Grip base has no super of this
 
+	if (OverrideMeleeSurfaceSettings.Num() > 0)
+	{
+		RebuildSurfaceLookupTable();
+	}
+	else
+	{
+		// Make sure the shared table is built before the first hit
+		UVRGlobalSettings::GetMeleeSurfaceGlobalLookupTable();
+	}
+
 	if (AActor * Owner = GetOwner())
 	{
 		FName CurrentCompName = NAME_None;
@@ -552,6 +604,7 @@ void UGS_Melee::OnBeginPlay_Implementation(UObject * CallingOwner)
 		{
 			Owner->OnActorHit.AddDynamic(this, &UGS_Melee::OnLodgeHitCallback);
 			bCheckLodge = bAlwaysTickPenetration;
+			UpdateSweptHitTicking();
 		}
 	}
 }
@@ -562,6 +615,17 @@ void UGS_Melee::OnEndPlay_Implementation(const EEndPlayReason::Type EndPlayReaso
 	{
 		Owner->OnActorHit.RemoveDynamic(this, &UGS_Melee::OnLodgeHitCallback);
 	}
+
+	if (UPrimitiveComponent * BodyComp = ComBodyComponent.Get())
+	{
+		if (FBodyInstance * rBodyInstance = BodyComp->GetBodyInstance())
+		{
+			rBodyInstance->OnRecalculatedMassProperties().RemoveAll(this);
+		}
+	}
+
+	ComBodyComponent.Reset();
+	InvalidateComCache();
 }
 
 void UGS_Melee::OnLodgeHitCallback(AActor* SelfActor, AActor* OtherActor, FVector NormalImpulse, const FHitResult& Hit)
@@ -569,34 +633,36 @@ void UGS_Melee::OnLodgeHitCallback(AActor* SelfActor, AActor* OtherActor, FVecto
 	if (!bCheckLodge || !bIsActive || bIsLodged || OtherActor == SelfActor)
 		return;
 
-	TArray<FBPHitSurfaceProperties> AllowedPenetrationSurfaceTypes;
+	// Swept mode generates its own hits, don't double up on them
+	if (bUseSweptHitDetection)
+		return;
 
-	if (OverrideMeleeSurfaceSettings.Num() > 0)
-	{
-		// Use our local copy
-		AllowedPenetrationSurfaceTypes = OverrideMeleeSurfaceSettings;
-	}
-	else
+	HandleLodgeHit(OtherActor, NormalImpulse, Hit);
+}
+
+void UGS_Melee::HandleLodgeHit(AActor* OtherActor, const FVector& NormalImpulse, const FHitResult& Hit, const FBPLodgeComponentInfo* SweptLodgeComponent)
+{
+	if (OverrideMeleeSurfaceSettings.Num() > 0 && OverrideMeleeSurfaceSettings.Num() != OverrideSurfaceLookupTable.Num())
 	{
-		// Use the global settings
-		UVRGlobalSettings::GetMeleeSurfaceGlobalSettings(AllowedPenetrationSurfaceTypes);
+		// The list was changed without a rebuild
+		RebuildSurfaceLookupTable();
 	}
+
+	// Use our local settings or the global ones
+	const FBPHitSurfaceLookupTable& SurfaceLookupTable = OverrideMeleeSurfaceSettings.Num() > 0 ? OverrideSurfaceLookupTable : UVRGlobalSettings::GetMeleeSurfaceGlobalLookupTable();
 	
 	FBPHitSurfaceProperties HitSurfaceProperties;
 	HitSurfaceProperties.SurfaceType = Hit.PhysMaterial->SurfaceType;
 
-	if (AllowedPenetrationSurfaceTypes.Num())
+	if (SurfaceLookupTable.Num())
 	{
 		// Reject bad surface types
 		if (!Hit.PhysMaterial.IsValid())
 			return;
 
-		EPhysicalSurface PhysSurfaceType = Hit.PhysMaterial->SurfaceType;
-		int32 IndexOfSurface = AllowedPenetrationSurfaceTypes.IndexOfByPredicate([&PhysSurfaceType](const FBPHitSurfaceProperties& Entry) { return Entry.SurfaceType == PhysSurfaceType; });
-
-		if (IndexOfSurface != INDEX_NONE)
+		if (const FBPHitSurfaceProperties* FoundSurface = SurfaceLookupTable.Find(Hit.PhysMaterial->SurfaceType))
 		{
-			HitSurfaceProperties = AllowedPenetrationSurfaceTypes[IndexOfSurface];
+			HitSurfaceProperties = *FoundSurface;
 		}
 		else
 		{
@@ -635,8 +701,9 @@ void UGS_Melee::OnLodgeHitCallback(AActor* SelfActor, AActor* OtherActor, FVecto
 		if (!LodgeData.TargetComponent.IsValid())
 			continue;
 
+		// Swept hits already know which component they came from
 		FBox LodgeBox = LodgeData.TargetComponent->Bounds.GetBox();
-		if (LodgeData.TargetComponent.IsValid() && LodgeBox.IsInsideOrOn(Hit.ImpactPoint))
+		if (SweptLodgeComponent ? (&LodgeData == SweptLodgeComponent) : LodgeBox.IsInsideOrOn(Hit.ImpactPoint))
 		{
 			FVector ForwardVec = LodgeData.TargetComponent->GetForwardVector();
 			
@@ -718,7 +785,11 @@ void UGS_Melee::HandlePostPhysicsHandle(UGripMotionControllerComponent* Gripping
 		}
 
 		if (COMType != EVRMeleeComType::VRPMELEECOM_Normal)
+		{
+			// The handle was just rebuilt, it may have moved the com on us
+			InvalidateComCache();
 			SetComBetweenHands(GrippingController, HandleInfo);
+		}
 	}
 	else
 	{
@@ -735,19 +806,35 @@ void UGS_Melee::SetComBetweenHands(UGripMotionControllerComponent* GrippingContr
 
 	if (COMType != EVRMeleeComType::VRPMELEECOM_Normal && SecondaryHand.IsValid())
 	{
+		const FVector NewComLocation = (HandleInfo->RootBoneRotation * ObjectRelativeGripCenter).GetLocation();
+
+		// Both hands run through here every time they update, only lock the body if the center actually moved and we haven't already written it this frame.
+		// Anything that can reset the com on the body invalidates the cache so those are always caught.
+		const bool bSkipWrite = bHasLastComLocation && (LastComWriteFrame == GFrameCounter || LastComLocation.Equals(NewComLocation, COMUpdateTolerance));
+
 		//if (PrimaryHand.HoldingController == GrippingController)
+		if (!bSkipWrite)
 		{
 			if (UPrimitiveComponent * PrimComp = Cast<UPrimitiveComponent>(GetParentSceneComp()))
 			{
 				if (FBodyInstance * rBodyInstance = PrimComp->GetBodyInstance())
 				{
+					if (!rBodyInstance->OnRecalculatedMassProperties().IsBoundToObject(this))
+					{
+						rBodyInstance->OnRecalculatedMassProperties().AddUObject(this, &UGS_Melee::OnParentMassRecalculated);
+						ComBodyComponent = PrimComp;
+					}
+
 					FPhysicsCommand::ExecuteWrite(rBodyInstance->ActorHandle, [&](const FPhysicsActorHandle& Actor)
 					{
 						FTransform localCom = FPhysicsInterface::GetComTransformLocal_AssumesLocked(Actor);
-						localCom.SetLocation((HandleInfo->RootBoneRotation * ObjectRelativeGripCenter).GetLocation());
+						localCom.SetLocation(NewComLocation);
 						FPhysicsInterface::SetComLocalPose_AssumesLocked(Actor, localCom);
-
 					});
+
+					LastComLocation = NewComLocation;
+					bHasLastComLocation = true;
+					LastComWriteFrame = GFrameCounter;
 				}
 			}
 		}
@@ -757,6 +844,153 @@ void UGS_Melee::SetComBetweenHands(UGripMotionControllerComponent* GrippingContr
 	}
 }
 
+void UGS_Melee::InvalidateComCache()
+{
+	bHasLastComLocation = false;
+}
+
+void UGS_Melee::OnParentMassRecalculated(FBodyInstance* BodyInstance)
+{
+	InvalidateComCache();
+}
+
+void UGS_Melee::UpdateSweptHitTicking()
+{
+	const bool bWantsTick = bUseSweptHitDetection && bCheckLodge;
+
+	if (bWantsTick && !bAllowTicking)
+	{
+		// Start fresh so we don't sweep across wherever the weapon was when we stopped
+		bHasLastSweptParentTransform = false;
+	}
+
+	SetTickEnabled(bWantsTick);
+}
+
+void UGS_Melee::SetUseSweptHitDetection(bool bNewUseSweptHitDetection)
+{
+	bUseSweptHitDetection = bNewUseSweptHitDetection;
+	UpdateSweptHitTicking();
+}
+
+void UGS_Melee::Tick(float DeltaTime)
+{
+	if (!bUseSweptHitDetection || !bCheckLodge || !bIsActive)
+		return;
+
+	PerformSweptHitDetection(DeltaTime);
+}
+
+void UGS_Melee::PerformSweptHitDetection(float DeltaTime)
+{
+	AActor* Owner = GetOwner();
+	UWorld* World = GetWorld();
+	USceneComponent* ParentComp = GetParentSceneComp();
+
+	if (!Owner || !World || !ParentComp || DeltaTime <= 0.0f)
+		return;
+
+	const FTransform CurrentParentTransform = ParentComp->GetComponentTransform();
+	const FTransform LastParentTransform = LastSweptParentTransform;
+	const bool bHadLastTransform = bHasLastSweptParentTransform;
+
+	LastSweptParentTransform = CurrentParentTransform;
+	bHasLastSweptParentTransform = true;
+
+	if (!bHadLastTransform || 
+		(LastParentTransform.GetLocation().Equals(CurrentParentTransform.GetLocation()) && LastParentTransform.GetRotation().Equals(CurrentParentTransform.GetRotation())))
+	{
+		return;
+	}
+
+	FComponentQueryParams Params(SCENE_QUERY_STAT(MeleeSweptHit), Owner);
+	Params.bReturnPhysicalMaterial = true;
+
+	// Don't hit the hands holding us
+	if (PrimaryHand.IsValid())
+		Params.AddIgnoredActor(PrimaryHand.HoldingController->GetOwner());
+	if (SecondaryHand.IsValid())
+		Params.AddIgnoredActor(SecondaryHand.HoldingController->GetOwner());
+
+	float BodyMass = 1.0f;
+	if (FBodyInstance* BodyInst = GetParentBodyInstance())
+	{
+		BodyMass = BodyInst->GetBodyMass();
+	}
+
+	struct FSweptMeleeHit
+	{
+		int32 LodgeIndex;
+		FHitResult Hit;
+		FVector Impulse;
+	};
+
+	TArray<FSweptMeleeHit, TInlineAllocator<4>> SweptHits;
+	TArray<FHitResult> Hits;
+	const int32 NumSubSteps = FMath::Clamp(SweptHitSubSteps, 1, 8);
+
+	// Interpolate the parent once per step, shared by all of the notifiers
+	TArray<FTransform, TInlineAllocator<8>> StepParentTransforms;
+	StepParentTransforms.AddUninitialized(NumSubSteps);
+	for (int32 Step = 1; Step <= NumSubSteps; ++Step)
+	{
+		StepParentTransforms[Step - 1].Blend(LastParentTransform, CurrentParentTransform, (float)Step / NumSubSteps);
+	}
+
+	// Run all of the sweeps first so that the events can't alter the weapon part way through
+	for (int32 LodgeIndex = 0; LodgeIndex < PenetrationNotifierComponents.Num(); ++LodgeIndex)
+	{
+		const FBPLodgeComponentInfo& LodgeData = PenetrationNotifierComponents[LodgeIndex];
+		UPrimitiveComponent* TargetComp = LodgeData.TargetComponent.Get();
+
+		if (!TargetComp)
+			continue;
+
+		// Re-pose the notifier off of the interpolated parent, so the sweep follows the arc of the swing instead of a straight line
+		const FTransform RelativeTransform = TargetComp->GetComponentTransform().GetRelativeTransform(CurrentParentTransform);
+		const FVector LastLocation = (RelativeTransform * LastParentTransform).GetLocation();
+
+		const FVector SweepImpulse = ((TargetComp->GetComponentLocation() - LastLocation) / DeltaTime) * BodyMass * SweptHitImpulseScaler;
+		FVector StepStart = LastLocation;
+
+		for (int32 Step = 0; Step < NumSubSteps; ++Step)
+		{
+			const FTransform StepTransform = RelativeTransform * StepParentTransforms[Step];
+			const FVector StepEnd = StepTransform.GetLocation();
+
+			Hits.Reset();
+			World->ComponentSweepMulti(Hits, TargetComp, StepStart, StepEnd, StepTransform.GetRotation(), Params);
+
+			// Only count new contacts, we are already touching anything we started inside of
+			const FHitResult* FirstHit = Hits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit && !Hit.bStartPenetrating; });
+
+			if (FirstHit)
+			{
+				SweptHits.Add({ LodgeIndex, *FirstHit, SweepImpulse });
+				break;
+			}
+
+			StepStart = StepEnd;
+		}
+	}
+
+	for (const FSweptMeleeHit& SweptHit : SweptHits)
+	{
+		// A previous hit may have lodged us
+		if (bIsLodged || !bCheckLodge)
+			break;
+
+		if (!PenetrationNotifierComponents.IsValidIndex(SweptHit.LodgeIndex))
+			continue;
+
+		AActor* OtherActor = SweptHit.Hit.GetActor();
+		if (!OtherActor || OtherActor == Owner)
+			continue;
+
+		HandleLodgeHit(OtherActor, SweptHit.Impulse, SweptHit.Hit, &PenetrationNotifierComponents[SweptHit.LodgeIndex]);
+	}
+}
+
 /*void UGS_Melee::Tick(float DeltaTime)
 {
 	AActor* myOwner = GetOwner();
@@ -106,6 +106,17 @@ void UGS_Physics::HandlePostPhysicsHandle(UGripMotionControllerComponent* Grippi
 	if(bSkipGripMassChecks)
 		HandleInfo->bSkipMassCheck = true;
 
+	// Only the handle being rebuilt needs its settings, the others were already filled when the hand count changed
+	TArray<FBPGripPair> HoldingControllers;
+	bool bIsHeld;
+	IVRGripInterface::Execute_IsHeld(GetParent(), HoldingControllers, bIsHeld);
 
-	UpdateDualHandInfo(GrippingController, false);
+	if (HoldingControllers.Num() > 1)
+	{
+		MultiHandPhysicsSettings.FillTo(HandleInfo);
+	}
+	else
+	{
+		SingleHandPhysicsSettings.FillTo(HandleInfo);
+	}
 }
\ No newline at end of file
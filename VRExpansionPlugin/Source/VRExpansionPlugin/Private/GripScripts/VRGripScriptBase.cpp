@@ -5,6 +5,7 @@
 #include "VRGripInterface.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/NetDriver.h"
+#include "Misc/VRGripScriptTickSubsystem.h"
 
  
 UVRGripScriptBase::UVRGripScriptBase(const FObjectInitializer& ObjectInitializer)
@@ -21,6 +22,7 @@ UVRGripScriptBase::UVRGripScriptBase(const FObjectInitializer& ObjectInitializer
 
 	bCanEverTick = false;
 	bAllowTicking = false;
+	bIsRegisteredForTick = false;
 }
 
 void UVRGripScriptBase::OnEndPlay_Implementation(const EEndPlayReason::Type EndPlayReason) {};
@@ -84,40 +86,40 @@ void UVRGripScriptBase::Tick(float DeltaTime)
 
 bool UVRGripScriptBase::IsTickable() const
 {
-	return bAllowTicking;
+	return bCanEverTick && bAllowTicking;
 }
 
-UWorld* UVRGripScriptBase::GetTickableGameObjectWorld() const
-{
-	return GetWorld();
-}
-
-bool UVRGripScriptBase::IsTickableInEditor() const
-{
-	return false;
-}
-
-bool UVRGripScriptBase::IsTickableWhenPaused() const
+void UVRGripScriptBase::SetTickEnabled(bool bTickEnabled)
 {
-	return false;
+	bAllowTicking = bTickEnabled;
+	UpdateTickRegistration();
 }
 
-ETickableTickType UVRGripScriptBase::GetTickableTickType() const
+void UVRGripScriptBase::UpdateTickRegistration()
 {
-	if(IsTemplate(RF_ClassDefaultObject))
-		return ETickableTickType::Never;
+	UWorld* World = GetWorld();
+	const bool bWantsTick = IsTickable() && !IsTemplate() && !IsPendingKill() && World && World->IsGameWorld();
 
-	return bCanEverTick ? ETickableTickType::Conditional : ETickableTickType::Never;
-}
+	if (bWantsTick == bIsRegisteredForTick)
+		return;
 
-TStatId UVRGripScriptBase::GetStatId() const
-{
-	RETURN_QUICK_DECLARE_CYCLE_STAT(UVRGripScriptBase, STATGROUP_Tickables);
-}
+	if (UVRGripScriptTickSubsystem* TickSubsystem = World ? World->GetSubsystem<UVRGripScriptTickSubsystem>() : nullptr)
+	{
+		if (bWantsTick)
+		{
+			TickSubsystem->RegisterScript(this);
+		}
+		else
+		{
+			TickSubsystem->UnregisterScript(this);
+		}
 
-void UVRGripScriptBase::SetTickEnabled(bool bTickEnabled)
-{
-	bAllowTicking = bTickEnabled;
+		bIsRegisteredForTick = bWantsTick;
+	}
+	else
+	{
+		bIsRegisteredForTick = false;
+	}
 }
 
 
@@ -312,15 +314,61 @@ UWorld* UVRGripScriptBase::GetWorld() const
 void UVRGripScriptBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	OnEndPlay(EndPlayReason);
+
+	if (bIsRegisteredForTick)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			if (UVRGripScriptTickSubsystem* TickSubsystem = World->GetSubsystem<UVRGripScriptTickSubsystem>())
+			{
+				TickSubsystem->UnregisterScript(this);
+			}
+		}
+
+		bIsRegisteredForTick = false;
+	}
 }
 
 void UVRGripScriptBase::BeginPlay(UObject * CallingOwner)
 {
 	// Notify the subscripts about begin play
 	OnBeginPlay(CallingOwner);
+
+	// Pick up scripts that start with ticking allowed
+	UpdateTickRegistration();
 }
 
 void UVRGripScriptBaseBP::Tick(float DeltaTime)
 {
 	ReceiveTick(DeltaTime);
+}
+void FVRGripScriptExecutionPlan::Rebuild()
+{
+	TransformSteps.Reset();
+	ScriptStates.Reset();
+	bOverridesDefaultTransform = false;
+
+	for (const TWeakObjectPtr<UVRGripScriptBase>& ScriptPtr : Scripts)
+	{
+		UVRGripScriptBase* Script = ScriptPtr.Get();
+		ScriptStates.Add(GetScriptState(Script));
+
+		if (!Script || !Script->bIsActive)
+			continue;
+
+		switch (Script->WorldTransformOverrideType)
+		{
+		case EGSTransformOverrideType::OverridesWorldTransform:
+		{
+			// One of the grip scripts overrides the default transform
+			bOverridesDefaultTransform = true;
+			TransformSteps.Add({ Script, EGSExecutionPhase::Override });
+		}break;
+		case EGSTransformOverrideType::ModifiesWorldTransform:
+		{
+			TransformSteps.Add({ Script, EGSExecutionPhase::Modifier });
+		}break;
+		default:break;
+		}
+	}
 }
\ No newline at end of file
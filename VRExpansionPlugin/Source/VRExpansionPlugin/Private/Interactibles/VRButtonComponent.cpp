@@ -1,6 +1,7 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "Interactibles/VRButtonComponent.h"
+#include "Misc/VRInteractibleUpdateSubsystem.h"
 #include "GameFramework/Character.h"
 
   //=============================================================================
@@ -81,7 +82,11 @@ void UVRButtonComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 {
 	// Call supers tick (though I don't think any of the base classes to this actually implement it)
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	TickInteractible(DeltaTime);
+}
 
+void UVRButtonComponent::TickInteractible(float DeltaTime)
+{
 	const float WorldTime = GetWorld()->GetTimeSeconds();
 
 	if (LocalInteractingComponent.IsValid())
@@ -134,7 +139,7 @@ void UVRButtonComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 		// Std precision tolerance should be fine
 		if (this->GetRelativeLocation().Equals(GetTargetRelativeLocation()))
 		{
-			this->SetComponentTickEnabled(false);
+			UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, false);
 
 			OnButtonEndInteraction.Broadcast(LocalLastInteractingActor.Get(), LocalLastInteractingComponent.Get());
 			ReceiveButtonEndInteraction(LocalLastInteractingActor.Get(), LocalLastInteractingComponent.Get());
@@ -277,9 +282,19 @@ void UVRButtonComponent::SetLastInteractingActor()
 }
 
 void UVRButtonComponent::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	BeginButtonInteraction(OtherComp);
+}
+
+void UVRButtonComponent::OnOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	EndButtonInteraction(OtherComp);
+}
+
+bool UVRButtonComponent::BeginButtonInteraction(UPrimitiveComponent* OtherComp)
 {
 	// Other Actor is the actor that triggered the event. Check that is not ourself.  
-	if (bIsEnabled && !LocalInteractingComponent.IsValid() && (bSkipOverlapFiltering || IsValidOverlap(OtherComp)))
+	if (OtherComp && bIsEnabled && !LocalInteractingComponent.IsValid() && (bSkipOverlapFiltering || IsValidOverlap(OtherComp)))
 	{
 		LocalInteractingComponent = OtherComp;
 
@@ -289,7 +304,7 @@ void UVRButtonComponent::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AAc
 		InitialComponentLoc = OriginalBaseTransform.InverseTransformPosition(this->GetComponentLocation());
 		bToggledThisTouch = false;
 
-		this->SetComponentTickEnabled(true);
+		UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, true);
 
 		if (LocalInteractingComponent != LocalLastInteractingComponent.Get())
 		{
@@ -297,10 +312,14 @@ void UVRButtonComponent::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AAc
 			OnButtonBeginInteraction.Broadcast(LocalLastInteractingActor.Get(), LocalLastInteractingComponent.Get());
 			ReceiveButtonBeginInteraction(LocalLastInteractingActor.Get(), LocalLastInteractingComponent.Get());
 		}
+
+		return true;
 	}
+
+	return false;
 }
 
-void UVRButtonComponent::OnOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+void UVRButtonComponent::EndButtonInteraction(UPrimitiveComponent* OtherComp)
 {
 	if (LocalInteractingComponent.IsValid() && OtherComp == LocalInteractingComponent)
 	{
@@ -345,7 +364,7 @@ void UVRButtonComponent::SetButtonToRestingPosition(bool bLerpToPosition)
 			this->SetRelativeLocation(InitialRelativeTransform.TransformPosition(SetAxisValue(NewDepth)), false);
 		}
 		else
-			this->SetComponentTickEnabled(true); // This will trigger the lerp to resting position
+			UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, true); // This will trigger the lerp to resting position
 
 	}break;
 	default:break;
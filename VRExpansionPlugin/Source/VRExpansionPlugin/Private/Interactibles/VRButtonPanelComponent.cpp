@@ -0,0 +1,203 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interactibles/VRButtonPanelComponent.h"
+#include "Interactibles/VRButtonComponent.h"
+
+  //=============================================================================
+UVRButtonPanelComponent::UVRButtonPanelComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	this->SetGenerateOverlapEvents(true);
+	this->PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.bCanEverTick = true;
+
+	this->SetCollisionResponseToAllChannels(ECR_Overlap);
+
+	bAutoRegisterChildButtons = true;
+	ButtonBoundsPadding = 0.0f;
+}
+
+void UVRButtonPanelComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (bAutoRegisterChildButtons)
+	{
+		TArray<USceneComponent*> Children;
+		GetChildrenComponents(true, Children);
+
+		for (USceneComponent* Child : Children)
+		{
+			if (UVRButtonComponent* Button = Cast<UVRButtonComponent>(Child))
+			{
+				RegisterButton(Button);
+			}
+		}
+	}
+
+	OnComponentBeginOverlap.AddUniqueDynamic(this, &UVRButtonPanelComponent::OnPanelOverlapBegin);
+	OnComponentEndOverlap.AddUniqueDynamic(this, &UVRButtonPanelComponent::OnPanelOverlapEnd);
+}
+
+void UVRButtonPanelComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	for (FVRPanelButtonEntry& Entry : PanelButtons)
+	{
+		if (Entry.Button.IsValid() && Entry.InteractingComponent.IsValid())
+		{
+			Entry.Button->EndButtonInteraction(Entry.InteractingComponent.Get());
+		}
+	}
+
+	PanelButtons.Empty();
+	OverlappingComponents.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UVRButtonPanelComponent::RegisterButton(UVRButtonComponent* Button)
+{
+	if (!Button)
+		return;
+
+	for (const FVRPanelButtonEntry& Entry : PanelButtons)
+	{
+		if (Entry.Button == Button)
+			return;
+	}
+
+	FVRPanelButtonEntry NewEntry;
+	NewEntry.Button = Button;
+	PanelButtons.Add(NewEntry);
+
+	// The panel handles the overlaps for this button now
+	Button->SetGenerateOverlapEvents(false);
+
+	if (OverlappingComponents.Num() > 0)
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UVRButtonPanelComponent::UnregisterButton(UVRButtonComponent* Button)
+{
+	if (!Button)
+		return;
+
+	for (int32 i = 0; i < PanelButtons.Num(); ++i)
+	{
+		if (PanelButtons[i].Button == Button)
+		{
+			if (PanelButtons[i].InteractingComponent.IsValid())
+			{
+				Button->EndButtonInteraction(PanelButtons[i].InteractingComponent.Get());
+			}
+
+			PanelButtons.RemoveAtSwap(i);
+			Button->SetGenerateOverlapEvents(true);
+			return;
+		}
+	}
+}
+
+void UVRButtonPanelComponent::OnPanelOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	// Ignore ourselves and the rest of the panel, the buttons do their own filtering on top of this when engaging
+	if (!OtherComp || OtherActor == GetOwner())
+		return;
+
+	OverlappingComponents.AddUnique(OtherComp);
+	SetComponentTickEnabled(true);
+}
+
+void UVRButtonPanelComponent::OnPanelOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	if (!OtherComp)
+		return;
+
+	OverlappingComponents.RemoveSwap(OtherComp);
+
+	// Release anything it was pressing right away, don't wait for the next tick
+	for (FVRPanelButtonEntry& Entry : PanelButtons)
+	{
+		if (Entry.InteractingComponent == OtherComp)
+		{
+			if (Entry.Button.IsValid())
+			{
+				Entry.Button->EndButtonInteraction(OtherComp);
+			}
+
+			Entry.InteractingComponent.Reset();
+		}
+	}
+}
+
+void UVRButtonPanelComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	UpdatePanelButtons();
+
+	// The buttons handle their own lerping back after release, we only need to run while something is in the panel
+	if (OverlappingComponents.Num() < 1)
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UVRButtonPanelComponent::UpdatePanelButtons()
+{
+	for (int32 i = OverlappingComponents.Num() - 1; i >= 0; --i)
+	{
+		if (!OverlappingComponents[i].IsValid())
+		{
+			OverlappingComponents.RemoveAtSwap(i);
+		}
+	}
+
+	for (int32 i = PanelButtons.Num() - 1; i >= 0; --i)
+	{
+		FVRPanelButtonEntry& Entry = PanelButtons[i];
+		UVRButtonComponent* Button = Entry.Button.Get();
+
+		if (!Button)
+		{
+			PanelButtons.RemoveAtSwap(i);
+			continue;
+		}
+
+		const FBox ButtonBox = Button->Bounds.GetBox().ExpandBy(ButtonBoundsPadding);
+
+		if (UPrimitiveComponent* Interactor = Entry.InteractingComponent.Get())
+		{
+			// The button may have let go on its own (disabled / reset), or the interactor left its bounds
+			if (Button->LocalInteractingComponent.Get() != Interactor)
+			{
+				Entry.InteractingComponent.Reset();
+			}
+			else if (!ButtonBox.Intersect(Interactor->Bounds.GetBox()))
+			{
+				Button->EndButtonInteraction(Interactor);
+				Entry.InteractingComponent.Reset();
+			}
+			else
+			{
+				continue;
+			}
+		}
+
+		if (Button->LocalInteractingComponent.IsValid())
+			continue;
+
+		for (const TWeakObjectPtr<UPrimitiveComponent>& OverlapComp : OverlappingComponents)
+		{
+			UPrimitiveComponent* Candidate = OverlapComp.Get();
+
+			if (Candidate && ButtonBox.Intersect(Candidate->Bounds.GetBox()) && Button->BeginButtonInteraction(Candidate))
+			{
+				Entry.InteractingComponent = Candidate;
+				break;
+			}
+		}
+	}
+}
@@ -1,6 +1,7 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "Interactibles/VRDialComponent.h"
+#include "Misc/VRInteractibleUpdateSubsystem.h"
 #include "Net/UnrealNetwork.h"
 
   //=============================================================================
@@ -15,6 +16,7 @@ UVRDialComponent::UVRDialComponent(const FObjectInitializer& ObjectInitializer)
 
 	// Defaulting these true so that they work by default in networked environments
 	bReplicateMovement = true;
+	bUseCompactStateReplication = false;
 
 	DialRotationAxis = EVRInteractibleAxis::Axis_Z;
 	InteractorRotationAxis = EVRInteractibleAxis::Axis_X;
@@ -62,6 +64,8 @@ void UVRDialComponent::GetLifetimeReplicatedProps(TArray< class FLifetimePropert
 
 	DOREPLIFETIME(UVRDialComponent, bRepGameplayTags);
 	DOREPLIFETIME(UVRDialComponent, bReplicateMovement);
+	DOREPLIFETIME(UVRDialComponent, bUseCompactStateReplication);
+	DOREPLIFETIME_CONDITION(UVRDialComponent, CompactState, COND_Custom);
 	DOREPLIFETIME_CONDITION(UVRDialComponent, GameplayTags, COND_Custom);
 }
 
@@ -72,9 +76,42 @@ void UVRDialComponent::PreReplication(IRepChangedPropertyTracker & ChangedProper
 	// Don't replicate if set to not do it
 	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRDialComponent, GameplayTags, bRepGameplayTags);
 
-	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeLocation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeRotation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeScale3D, bReplicateMovement);
+	// Send the quantized state instead of the transform if enabled
+	const bool bReplicateCompactState = bReplicateMovement && bUseCompactStateReplication;
+	const bool bReplicateTransform = bReplicateMovement && !bUseCompactStateReplication;
+
+	if (bReplicateCompactState)
+	{
+		UpdateCompactState();
+	}
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRDialComponent, CompactState, bReplicateCompactState);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeLocation, bReplicateTransform);
+	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeRotation, bReplicateTransform);
+	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeScale3D, bReplicateTransform);
+}
+
+// Range that CurRotBackEnd can be in, rollover dials can go past a full rotation
+static void GetDialCompactStateRange(const UVRDialComponent* Dial, float& OutMin, float& OutMax)
+{
+	OutMin = -FMath::Max(360.0f, Dial->CClockwiseMaximumDialAngle);
+	OutMax = FMath::Max(360.0f, Dial->ClockwiseMaximumDialAngle);
+}
+
+void UVRDialComponent::UpdateCompactState()
+{
+	float MinAngle, MaxAngle;
+	GetDialCompactStateRange(this, MinAngle, MaxAngle);
+	CompactState.SetScalar(CurRotBackEnd, MinAngle, MaxAngle);
+}
+
+void UVRDialComponent::OnRep_CompactState()
+{
+	// Rebuild our transform from the replicated state
+	float MinAngle, MaxAngle;
+	GetDialCompactStateRange(this, MinAngle, MaxAngle);
+	SetDialAngle(CompactState.GetScalar(MinAngle, MaxAngle));
 }
 
 void UVRDialComponent::OnRegister()
@@ -93,6 +130,11 @@ void UVRDialComponent::BeginPlay()
 }
 
 void UVRDialComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+{
+	TickInteractible(DeltaTime);
+}
+
+void UVRDialComponent::TickInteractible(float DeltaTime)
 {
 	if (bIsLerping)
 	{
@@ -111,7 +153,7 @@ void UVRDialComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 
 		if (CurRotBackEnd == 0.f)
 		{
-			this->SetComponentTickEnabled(false);
+			UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, false);
 			bIsLerping = false;
 			OnDialFinishedLerping.Broadcast();
 			ReceiveDialFinishedLerping();
@@ -119,7 +161,7 @@ void UVRDialComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 	}
 	else
 	{
-		this->SetComponentTickEnabled(false); 
+		UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, false); 
 	}
 }
 
@@ -258,10 +300,10 @@ void UVRDialComponent::OnGripRelease_Implementation(UGripMotionControllerCompone
 	if (bLerpBackOnRelease)
 	{
 		bIsLerping = true;
-		this->SetComponentTickEnabled(true);
+		UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, true);
 	}
 	else
-		this->SetComponentTickEnabled(false);
+		UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, false);
 
 	OnDropped.Broadcast(ReleasingController, GripInformation, bWasSocketed);
 }
@@ -1,6 +1,7 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "Interactibles/VRLeverComponent.h"
+#include "Misc/VRInteractibleUpdateSubsystem.h"
 #include "Net/UnrealNetwork.h"
 
   //=============================================================================
@@ -15,6 +16,7 @@ UVRLeverComponent::UVRLeverComponent(const FObjectInitializer& ObjectInitializer
 
 	// Defaulting these true so that they work by default in networked environments
 	bReplicateMovement = true;
+	bUseCompactStateReplication = false;
 
 	MovementReplicationSetting = EGripMovementReplicationSettings::ForceClientSideMovement;
 	BreakDistance = 100.0f;
@@ -87,6 +89,8 @@ void UVRLeverComponent::GetLifetimeReplicatedProps(TArray< class FLifetimeProper
 
 	DOREPLIFETIME(UVRLeverComponent, bRepGameplayTags);
 	DOREPLIFETIME(UVRLeverComponent, bReplicateMovement);
+	DOREPLIFETIME(UVRLeverComponent, bUseCompactStateReplication);
+	DOREPLIFETIME_CONDITION(UVRLeverComponent, CompactState, COND_Custom);
 	DOREPLIFETIME_CONDITION(UVRLeverComponent, GameplayTags, COND_Custom);
 }
 
@@ -100,9 +104,33 @@ void UVRLeverComponent::PreReplication(IRepChangedPropertyTracker & ChangedPrope
 	// Don't replicate if set to not do it
 	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRLeverComponent, GameplayTags, bRepGameplayTags);
 
-	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeLocation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeRotation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeScale3D,	bReplicateMovement);
+	// Send the quantized state instead of the transform if enabled
+	const bool bReplicateCompactState = bReplicateMovement && bUseCompactStateReplication;
+	const bool bReplicateTransform = bReplicateMovement && !bUseCompactStateReplication;
+
+	if (bReplicateCompactState)
+	{
+		UpdateCompactState();
+	}
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRLeverComponent, CompactState, bReplicateCompactState);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeLocation, bReplicateTransform);
+	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeRotation, bReplicateTransform);
+	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeScale3D, bReplicateTransform);
+}
+
+void UVRLeverComponent::UpdateCompactState()
+{
+	// Rotation relative to our initial transform, covers both the single and dual axis modes
+	CompactState.SetRotator(this->GetRelativeTransform().GetRelativeTransform(InitialRelativeTransform).Rotator());
+}
+
+void UVRLeverComponent::OnRep_CompactState()
+{
+	// Rebuild our transform from the replicated state
+	this->SetRelativeRotation((FTransform(CompactState.GetRotator()) * InitialRelativeTransform).GetRotation());
+	ReCalculateCurrentAngle();
 }
 
 void UVRLeverComponent::OnRegister()
@@ -124,7 +152,11 @@ void UVRLeverComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 {
 	// Call supers tick (though I don't think any of the base classes to this actually implement it)
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	TickInteractible(DeltaTime);
+}
 
+void UVRLeverComponent::TickInteractible(float DeltaTime)
+{
 	bool bWasLerping = bIsLerping;
 
 	// If we are locked then end the lerp, no point
@@ -163,7 +195,7 @@ void UVRLeverComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 
 			if (LerpedQuat.IsIdentity())
 			{
-				this->SetComponentTickEnabled(false);
+				UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, false);
 				bIsLerping = false;
 				bReplicateMovement = bOriginalReplicatesMovement;
 				this->SetRelativeRotation(InitialRelativeTransform.Rotator());
@@ -407,7 +439,7 @@ void UVRLeverComponent::OnGrip_Implementation(UGripMotionControllerComponent * G
 	bIsInFirstTick = true;
 	MomentumAtDrop = 0.0f;
 
-	this->SetComponentTickEnabled(true);
+	UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, true);
 
 	OnGripped.Broadcast(GrippingController, GripInformation);
 }
@@ -424,13 +456,13 @@ void UVRLeverComponent::OnGripRelease_Implementation(UGripMotionControllerCompon
 	if (LeverReturnTypeWhenReleased != EVRInteractibleLeverReturnType::Stay)
 	{		
 		bIsLerping = true;
-		this->SetComponentTickEnabled(true);
+		UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, true);
 		if (MovementReplicationSetting != EGripMovementReplicationSettings::ForceServerSideMovement)
 			bReplicateMovement = false;
 	}
 	else
 	{
-		this->SetComponentTickEnabled(false);
+		UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, false);
 		bReplicateMovement = bOriginalReplicatesMovement;
 	}
 
@@ -870,7 +902,7 @@ void UVRLeverComponent::LerpAxis(float CurrentAngle, float DeltaTime)
 		if (FMath::IsNearlyZero(MomentumAtDrop * DeltaTime, 0.1f))
 		{
 			MomentumAtDrop = 0.0f;
-			this->SetComponentTickEnabled(false);
+			UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, false);
 			bIsLerping = false;
 			bReplicateMovement = bOriginalReplicatesMovement;
 			return;
@@ -906,7 +938,7 @@ void UVRLeverComponent::LerpAxis(float CurrentAngle, float DeltaTime)
 		}
 		else
 		{
-			this->SetComponentTickEnabled(false);
+			UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, false);
 			bIsLerping = false;
 			bReplicateMovement = bOriginalReplicatesMovement;
 			FTransform CalcTransform = (FTransform(UVRInteractibleFunctionLibrary::SetAxisValueRot((EVRInteractibleAxis)LeverRotationAxis, TargetAngle, FRotator::ZeroRotator)) * InitialRelativeTransform);
@@ -15,6 +15,7 @@ UVRMountComponent::UVRMountComponent(const FObjectInitializer& ObjectInitializer
 
 	// Defaulting these true so that they work by default in networked environments
 	bReplicateMovement = true;
+	bUseCompactStateReplication = false;
 
 	MovementReplicationSetting = EGripMovementReplicationSettings::ForceClientSideMovement;
 	BreakDistance = 100.0f;
@@ -52,6 +53,8 @@ void UVRMountComponent::GetLifetimeReplicatedProps(TArray< class FLifetimeProper
 
 	DOREPLIFETIME(UVRMountComponent, bRepGameplayTags);
 	DOREPLIFETIME(UVRMountComponent, bReplicateMovement);
+	DOREPLIFETIME(UVRMountComponent, bUseCompactStateReplication);
+	DOREPLIFETIME_CONDITION(UVRMountComponent, CompactState, COND_Custom);
 	DOREPLIFETIME_CONDITION(UVRMountComponent, GameplayTags, COND_Custom);
 }
 
@@ -62,9 +65,31 @@ void UVRMountComponent::PreReplication(IRepChangedPropertyTracker & ChangedPrope
 	// Don't replicate if set to not do it
 	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRMountComponent, GameplayTags, bRepGameplayTags);
 
-	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeLocation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeRotation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeScale3D, bReplicateMovement);
+	// Send the quantized state instead of the transform if enabled
+	const bool bReplicateCompactState = bReplicateMovement && bUseCompactStateReplication;
+	const bool bReplicateTransform = bReplicateMovement && !bUseCompactStateReplication;
+
+	if (bReplicateCompactState)
+	{
+		UpdateCompactState();
+	}
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRMountComponent, CompactState, bReplicateCompactState);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeLocation, bReplicateTransform);
+	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeRotation, bReplicateTransform);
+	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeScale3D, bReplicateTransform);
+}
+
+void UVRMountComponent::UpdateCompactState()
+{
+	CompactState.SetRotator(this->GetRelativeTransform().GetRelativeTransform(InitialRelativeTransform).Rotator());
+}
+
+void UVRMountComponent::OnRep_CompactState()
+{
+	// Rebuild our transform from the replicated state
+	this->SetRelativeRotation((FTransform(CompactState.GetRotator()) * InitialRelativeTransform).GetRotation());
 }
 
 void UVRMountComponent::OnRegister()
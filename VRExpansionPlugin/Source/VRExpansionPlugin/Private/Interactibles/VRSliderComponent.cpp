@@ -1,8 +1,156 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "Interactibles/VRSliderComponent.h"
+#include "Misc/VRInteractibleUpdateSubsystem.h"
 #include "Net/UnrealNetwork.h"
 
+DECLARE_CYCLE_STAT(TEXT("VRSlider Closest Spline Key (Lookup Table)"), STAT_VRSliderSplineKeyTable, STATGROUP_VRInteractibles);
+DECLARE_CYCLE_STAT(TEXT("VRSlider Closest Spline Key (Spline Search)"), STAT_VRSliderSplineKeySearch, STATGROUP_VRInteractibles);
+DECLARE_CYCLE_STAT(TEXT("VRSlider Build Spline Lookup Table"), STAT_VRSliderSplineTableBuild, STATGROUP_VRInteractibles);
+
+void FVRSliderSplineLookupTable::Reset()
+{
+	Locations.Reset();
+	InputKeys.Reset();
+	Buckets.Reset();
+	Spline.Reset();
+	NumSplinePoints = 0;
+	SplineLength = 0.0f;
+}
+
+bool FVRSliderSplineLookupTable::IsValidFor(const USplineComponent* InSpline) const
+{
+	return InSpline && Spline.Get() == InSpline && Locations.Num() > 1 &&
+		NumSplinePoints == InSpline->GetNumberOfSplinePoints() &&
+		SplineLength == InSpline->SplineCurves.GetSplineLength();
+}
+
+void FVRSliderSplineLookupTable::Build(USplineComponent* InSpline)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VRSliderSplineTableBuild);
+
+	Reset();
+
+	if (!InSpline)
+		return;
+
+	Spline = InSpline;
+	NumSplinePoints = InSpline->GetNumberOfSplinePoints();
+	SplineLength = InSpline->SplineCurves.GetSplineLength();
+
+	// The reparam table is already sampled at even steps along each segment and maps distance to input key
+	const TArray<FInterpCurvePoint<float>>& ReparamPoints = InSpline->SplineCurves.ReparamTable.Points;
+	const int32 NumSamples = ReparamPoints.Num();
+
+	if (NumSamples < 2)
+		return;
+
+	Locations.Reserve(NumSamples);
+	InputKeys.Reserve(NumSamples);
+
+	for (const FInterpCurvePoint<float>& ReparamPoint : ReparamPoints)
+	{
+		InputKeys.Add(ReparamPoint.OutVal);
+		Locations.Add(InSpline->SplineCurves.Position.Eval(ReparamPoint.OutVal, FVector::ZeroVector));
+	}
+
+	// Around four segments per cell on average
+	BucketSize = FMath::Max(1.0f, (SplineLength / (float)(NumSamples - 1)) * 4.0f);
+
+	MinCell = GetCell(Locations[0]);
+	MaxCell = MinCell;
+
+	for (int32 SegmentIndex = 0; SegmentIndex < NumSamples - 1; ++SegmentIndex)
+	{
+		const FIntVector CellA = GetCell(Locations[SegmentIndex]);
+		const FIntVector CellB = GetCell(Locations[SegmentIndex + 1]);
+		const FIntVector SegMin(FMath::Min(CellA.X, CellB.X), FMath::Min(CellA.Y, CellB.Y), FMath::Min(CellA.Z, CellB.Z));
+		const FIntVector SegMax(FMath::Max(CellA.X, CellB.X), FMath::Max(CellA.Y, CellB.Y), FMath::Max(CellA.Z, CellB.Z));
+
+		for (int32 X = SegMin.X; X <= SegMax.X; ++X)
+		{
+			for (int32 Y = SegMin.Y; Y <= SegMax.Y; ++Y)
+			{
+				for (int32 Z = SegMin.Z; Z <= SegMax.Z; ++Z)
+				{
+					Buckets.FindOrAdd(FIntVector(X, Y, Z)).Add(SegmentIndex);
+				}
+			}
+		}
+
+		MinCell = FIntVector(FMath::Min(MinCell.X, SegMin.X), FMath::Min(MinCell.Y, SegMin.Y), FMath::Min(MinCell.Z, SegMin.Z));
+		MaxCell = FIntVector(FMath::Max(MaxCell.X, SegMax.X), FMath::Max(MaxCell.Y, SegMax.Y), FMath::Max(MaxCell.Z, SegMax.Z));
+	}
+}
+
+float FVRSliderSplineLookupTable::FindInputKeyClosestToLocalLocation(const FVector& LocalLocation) const
+{
+	if (Locations.Num() < 2)
+		return 0.0f;
+
+	// Start from the closest cell in the grid and search outwards in rings until no closer segment can exist
+	const FVector GridMin = FVector(MinCell) * BucketSize;
+	const FVector GridMax = FVector(MaxCell + FIntVector(1, 1, 1)) * BucketSize;
+	const FVector ClampedLocation = FVector(FMath::Clamp(LocalLocation.X, GridMin.X, GridMax.X), FMath::Clamp(LocalLocation.Y, GridMin.Y, GridMax.Y), FMath::Clamp(LocalLocation.Z, GridMin.Z, GridMax.Z));
+	const float DistToGridSq = FVector::DistSquared(LocalLocation, ClampedLocation);
+
+	FIntVector CenterCell = GetCell(ClampedLocation);
+	CenterCell = FIntVector(FMath::Clamp(CenterCell.X, MinCell.X, MaxCell.X), FMath::Clamp(CenterCell.Y, MinCell.Y, MaxCell.Y), FMath::Clamp(CenterCell.Z, MinCell.Z, MaxCell.Z));
+
+	const int32 MaxRing = FMath::Max3(
+		FMath::Max(CenterCell.X - MinCell.X, MaxCell.X - CenterCell.X),
+		FMath::Max(CenterCell.Y - MinCell.Y, MaxCell.Y - CenterCell.Y),
+		FMath::Max(CenterCell.Z - MinCell.Z, MaxCell.Z - CenterCell.Z));
+
+	float BestDistSq = BIG_NUMBER;
+	int32 BestSegment = 0;
+	float BestAlpha = 0.0f;
+
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		// Everything in this ring or further is at least this far away
+		const float RingDist = FMath::Max(0, Ring - 1) * BucketSize;
+		if (DistToGridSq + (RingDist * RingDist) > BestDistSq)
+			break;
+
+		for (int32 X = CenterCell.X - Ring; X <= CenterCell.X + Ring; ++X)
+		{
+			for (int32 Y = CenterCell.Y - Ring; Y <= CenterCell.Y + Ring; ++Y)
+			{
+				for (int32 Z = CenterCell.Z - Ring; Z <= CenterCell.Z + Ring; ++Z)
+				{
+					// Only the shell of the ring, the inside was already visited
+					if (FMath::Max3(FMath::Abs(X - CenterCell.X), FMath::Abs(Y - CenterCell.Y), FMath::Abs(Z - CenterCell.Z)) != Ring)
+						continue;
+
+					const TArray<int32>* Segments = Buckets.Find(FIntVector(X, Y, Z));
+					if (!Segments)
+						continue;
+
+					for (const int32 SegmentIndex : *Segments)
+					{
+						const FVector& Start = Locations[SegmentIndex];
+						const FVector Segment = Locations[SegmentIndex + 1] - Start;
+						const float SegmentSizeSq = Segment.SizeSquared();
+						const float Alpha = SegmentSizeSq > SMALL_NUMBER ? FMath::Clamp(FVector::DotProduct(LocalLocation - Start, Segment) / SegmentSizeSq, 0.0f, 1.0f) : 0.0f;
+						const float DistSq = FVector::DistSquared(LocalLocation, Start + (Segment * Alpha));
+
+						// Ties go to the earlier segment so the result doesn't depend on bucket order
+						if (DistSq < BestDistSq || (DistSq == BestDistSq && SegmentIndex < BestSegment))
+						{
+							BestDistSq = DistSq;
+							BestSegment = SegmentIndex;
+							BestAlpha = Alpha;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return FMath::Lerp(InputKeys[BestSegment], InputKeys[BestSegment + 1], BestAlpha);
+}
+
   //=============================================================================
 UVRSliderComponent::UVRSliderComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -15,6 +163,7 @@ UVRSliderComponent::UVRSliderComponent(const FObjectInitializer& ObjectInitializ
 
 	// Defaulting these true so that they work by default in networked environments
 	bReplicateMovement = true;
+	bUseCompactStateReplication = false;
 
 	MovementReplicationSetting = EGripMovementReplicationSettings::ForceClientSideMovement;
 	BreakDistance = 100.0f;
@@ -46,6 +195,7 @@ UVRSliderComponent::UVRSliderComponent(const FObjectInitializer& ObjectInitializ
 	bFollowSplineRotationAndScale = false;
 	SplineLerpType = EVRInteractibleSliderLerpType::Lerp_None;
 	SplineLerpValue = 8.f;
+	bUseSplineLookupTable = false;
 
 	GripPriority = 1;
 	LastSliderProgressState = -1.0f;
@@ -77,6 +227,8 @@ void UVRSliderComponent::GetLifetimeReplicatedProps(TArray< class FLifetimePrope
 
 	DOREPLIFETIME(UVRSliderComponent, bRepGameplayTags);
 	DOREPLIFETIME(UVRSliderComponent, bReplicateMovement);
+	DOREPLIFETIME(UVRSliderComponent, bUseCompactStateReplication);
+	DOREPLIFETIME_CONDITION(UVRSliderComponent, CompactState, COND_Custom);
 	DOREPLIFETIME_CONDITION(UVRSliderComponent, GameplayTags, COND_Custom);
 }
 
@@ -91,9 +243,58 @@ void UVRSliderComponent::PreReplication(IRepChangedPropertyTracker & ChangedProp
 	// Don't replicate if set to not do it
 	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRSliderComponent, GameplayTags, bRepGameplayTags);
 
-	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeLocation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeRotation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeScale3D, bReplicateMovement);
+	// Send the quantized state instead of the transform if enabled
+	const bool bReplicateCompactState = bReplicateMovement && bUseCompactStateReplication;
+	const bool bReplicateTransform = bReplicateMovement && !bUseCompactStateReplication;
+
+	if (bReplicateCompactState)
+	{
+		UpdateCompactState();
+	}
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRSliderComponent, CompactState, bReplicateCompactState);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeLocation, bReplicateTransform);
+	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeRotation, bReplicateTransform);
+	DOREPLIFETIME_ACTIVE_OVERRIDE_PRIVATE_PROPERTY(USceneComponent, RelativeScale3D, bReplicateTransform);
+}
+
+void UVRSliderComponent::UpdateCompactState()
+{
+	if (SplineComponentToFollow != nullptr)
+	{
+		CompactState.SetScalar(CurrentSliderProgress, 0.0f, 1.0f);
+		return;
+	}
+
+	// The clamp works per axis, so the location isn't always on the lerp line that the scalar progress describes
+	FVector MinScale, Dist;
+	GetSlideExtents(MinScale, Dist);
+
+	const FVector SlideLocation = InitialRelativeTransform.InverseTransformPosition(this->GetRelativeLocation());
+	const FVector Offset = SlideLocation + MinScale;
+
+	CompactState.SetUnitVector(FVector(
+		Dist.X != 0.0f ? Offset.X / Dist.X : 0.0f,
+		Dist.Y != 0.0f ? Offset.Y / Dist.Y : 0.0f,
+		Dist.Z != 0.0f ? Offset.Z / Dist.Z : 0.0f
+	));
+}
+
+void UVRSliderComponent::OnRep_CompactState()
+{
+	// Rebuild our transform from the replicated state
+	if (SplineComponentToFollow != nullptr)
+	{
+		SetSliderProgress(CompactState.GetScalar(0.0f, 1.0f));
+		return;
+	}
+
+	FVector MinScale, Dist;
+	GetSlideExtents(MinScale, Dist);
+
+	this->SetRelativeLocation(InitialRelativeTransform.TransformPosition((CompactState.GetUnitVector() * Dist) - MinScale));
+	CalculateSliderProgress();
 }
 
 void UVRSliderComponent::OnRegister()
@@ -125,7 +326,11 @@ void UVRSliderComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 {
 	// Call supers tick (though I don't think any of the base classes to this actually implement it)
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	TickInteractible(DeltaTime);
+}
 
+void UVRSliderComponent::TickInteractible(float DeltaTime)
+{
 	// If we are locked then end the lerp, no point
 	if (bIsLocked)
 	{
@@ -133,7 +338,7 @@ void UVRSliderComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 		OnSliderFinishedLerping.Broadcast(CurrentSliderProgress);
 		ReceiveSliderFinishedLerping(CurrentSliderProgress);
 
-		this->SetComponentTickEnabled(false);
+		UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, false);
 		bReplicateMovement = bOriginalReplicatesMovement;
 
 		return;
@@ -190,7 +395,7 @@ void UVRSliderComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 			OnSliderFinishedLerping.Broadcast(CurrentSliderProgress);
 			ReceiveSliderFinishedLerping(CurrentSliderProgress);
 
-			this->SetComponentTickEnabled(false);
+			UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, false);
 			bReplicateMovement = bOriginalReplicatesMovement;
 		}
 		
@@ -224,7 +429,7 @@ void UVRSliderComponent::TickGrip_Implementation(UGripMotionControllerComponent
 	if (SplineComponentToFollow != nullptr)
 	{
 		FVector WorldCalculatedLocation = CurrentRelativeTransform.TransformPosition(CalculatedLocation);
-		float ClosestKey = SplineComponentToFollow->FindInputKeyClosestToWorldLocation(WorldCalculatedLocation);
+		float ClosestKey = FindSplineInputKeyClosestToWorldLocation(WorldCalculatedLocation);
 
 		if (bSliderUsesSnapPoints)
 		{
@@ -269,7 +474,11 @@ void UVRSliderComponent::TickGrip_Implementation(UGripMotionControllerComponent
 			}
 			else if (bLerpToNewKey)
 			{
-				trans = SplineComponentToFollow->FindTransformClosestToWorldLocation(WorldCalculatedLocation, ESplineCoordinateSpace::World, true);
+				// The key is already the closest one, no need to search the spline again
+				if (bUseSplineLookupTable)
+					trans = SplineComponentToFollow->GetTransformAtSplineInputKey(ClosestKey, ESplineCoordinateSpace::World, true);
+				else
+					trans = SplineComponentToFollow->FindTransformClosestToWorldLocation(WorldCalculatedLocation, ESplineCoordinateSpace::World, true);
 				bChangedLocation = true;
 			}
 
@@ -291,7 +500,10 @@ void UVRSliderComponent::TickGrip_Implementation(UGripMotionControllerComponent
 			}
 			else if (bLerpToNewKey)
 			{
-				WorldLocation = SplineComponentToFollow->FindLocationClosestToWorldLocation(WorldCalculatedLocation, ESplineCoordinateSpace::World);
+				if (bUseSplineLookupTable)
+					WorldLocation = SplineComponentToFollow->GetLocationAtSplineInputKey(ClosestKey, ESplineCoordinateSpace::World);
+				else
+					WorldLocation = SplineComponentToFollow->FindLocationClosestToWorldLocation(WorldCalculatedLocation, ESplineCoordinateSpace::World);
 				bChangedLocation = true;
 			}
 
@@ -410,14 +622,14 @@ void UVRSliderComponent::OnGripRelease_Implementation(UGripMotionControllerCompo
 	if (SliderBehaviorWhenReleased != EVRInteractibleSliderDropBehavior::Stay)
 	{
 		bIsLerping = true;
-		this->SetComponentTickEnabled(true);
+		UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, true);
 
 		if(MovementReplicationSetting != EGripMovementReplicationSettings::ForceServerSideMovement)
 			bReplicateMovement = false;
 	}
 	else
 	{
-		this->SetComponentTickEnabled(false);
+		UVRInteractibleUpdateSubsystem::SetUpdateEnabled(this, false);
 		bReplicateMovement = bOriginalReplicatesMovement;
 	}
 
@@ -584,16 +796,22 @@ bool UVRSliderComponent::GetGripScripts_Implementation(TArray<UVRGripScriptBase*
 	return false;
 }
 
-FVector UVRSliderComponent::ClampSlideVector(FVector ValueToClamp)
+void UVRSliderComponent::GetSlideExtents(FVector& OutMinScale, FVector& OutDist) const
 {
 	FVector fScaleFactor = FVector(1.0f);
 
 	if (bSlideDistanceIsInParentSpace)
 		fScaleFactor = fScaleFactor / InitialRelativeTransform.GetScale3D();
 
-	FVector MinScale = (bUseLegacyLogic ? MinSlideDistance : MinSlideDistance.GetAbs()) * fScaleFactor;
+	OutMinScale = (bUseLegacyLogic ? MinSlideDistance : MinSlideDistance.GetAbs()) * fScaleFactor;
+	OutDist = (bUseLegacyLogic ? (MinSlideDistance + MaxSlideDistance) : (MinSlideDistance.GetAbs() + MaxSlideDistance.GetAbs())) * fScaleFactor;
+}
+
+FVector UVRSliderComponent::ClampSlideVector(FVector ValueToClamp)
+{
+	FVector MinScale, Dist;
+	GetSlideExtents(MinScale, Dist);
 
-	FVector Dist = (bUseLegacyLogic ? (MinSlideDistance + MaxSlideDistance) : (MinSlideDistance.GetAbs() + MaxSlideDistance.GetAbs())) * fScaleFactor;
 	FVector Progress = (ValueToClamp - (-MinScale)) / Dist;
 
 	if (bSliderUsesSnapPoints)
@@ -647,7 +865,7 @@ float UVRSliderComponent::GetCurrentSliderProgress(FVector CurLocation, bool bUs
 		float ClosestKey = CurKey;
 
 		if (!bUseKeyInstead)
-			ClosestKey = SplineComponentToFollow->FindInputKeyClosestToWorldLocation(CurLocation);
+			ClosestKey = FindSplineInputKeyClosestToWorldLocation(CurLocation);
 
 		/*int32 primaryKey = FMath::TruncToInt(ClosestKey);
 
@@ -697,9 +915,43 @@ void UVRSliderComponent::GetLerpedKey(float &ClosestKey, float DeltaTime)
 	}
 }
 
+float UVRSliderComponent::FindSplineInputKeyClosestToWorldLocation(const FVector& WorldLocation)
+{
+	if (!SplineComponentToFollow)
+		return 0.0f;
+
+	if (bUseSplineLookupTable)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VRSliderSplineKeyTable);
+
+		if (!SplineLookupTable.IsValidFor(SplineComponentToFollow))
+		{
+			SplineLookupTable.Build(SplineComponentToFollow);
+		}
+
+		if (SplineLookupTable.Locations.Num() > 1)
+		{
+			const FVector LocalLocation = SplineComponentToFollow->GetComponentTransform().InverseTransformPosition(WorldLocation);
+			return SplineLookupTable.FindInputKeyClosestToLocalLocation(LocalLocation);
+		}
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_VRSliderSplineKeySearch);
+	return SplineComponentToFollow->FindInputKeyClosestToWorldLocation(WorldLocation);
+}
+
+void UVRSliderComponent::RebuildSplineLookupTable()
+{
+	if (SplineComponentToFollow && bUseSplineLookupTable)
+		SplineLookupTable.Build(SplineComponentToFollow);
+	else
+		SplineLookupTable.Reset();
+}
+
 void UVRSliderComponent::SetSplineComponentToFollow(USplineComponent * SplineToFollow)
 {
 	SplineComponentToFollow = SplineToFollow;
+	RebuildSplineLookupTable();
 	
 	if (SplineToFollow != nullptr)
 		ResetToParentSplineLocation();
@@ -34,10 +34,19 @@ DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Listener Update"), STAT_AI_Sen
 DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Register Target"), STAT_AI_Sense_Sight_RegisterTarget, STATGROUP_AI);
 DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Remove By Listener"), STAT_AI_Sense_Sight_RemoveByListener, STATGROUP_AI);
 DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Remove To Target"), STAT_AI_Sense_Sight_RemoveToTarget, STATGROUP_AI);
+DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Process Async Traces"), STAT_AI_Sense_Sight_ProcessAsyncTraces, STATGROUP_AI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Perception Sense: Sight, Async Traces Submitted"), STAT_AI_Sense_Sight_AsyncTracesSubmitted, STATGROUP_AI);
+DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Spatial Hash Update"), STAT_AI_Sense_Sight_SpatialHash, STATGROUP_AI);
 
 
 static const int32 DefaultMaxTracesPerTick = 6;
 static const int32 DefaultMinQueriesPerTimeSliceCheck = 40;
+static const int32 DefaultMaxAsyncTracesPerTick = 64;
+static const float DefaultSightSpatialHashCellSize = 2000.0f;
+
+// Pairs are only re-checked when one side changes cell, while both stay put each can still move a cell diagonal (sqrt(2) cells)
+// so the gap can close by 2 * sqrt(2) cells. Pad the pairing range by more than that so nothing can sneak into sight unpaired.
+static const float SightSpatialHashDriftCells = 3.0f;
 
 enum class EForEachResult : uint8
 {
@@ -138,6 +147,14 @@ UAISense_Sight_VR::UAISense_Sight_VR(const FObjectInitializer& ObjectInitializer
 	, HighImportanceQueryDistanceThreshold(300.f)
 	, MaxQueryImportance(60.f)
 	, SightLimitQueryImportance(10.f)
+	, bUseAsyncSightTraces(false)
+	, MaxAsyncTracesPerTick(DefaultMaxAsyncTracesPerTick)
+	, bUseVRBodyVisibilityProfile(false)
+	, bUseSightSpatialHash(false)
+	, SightSpatialHashCellSize(DefaultSightSpatialHashCellSize)
+	, SightSpatialHashUpdateInterval(0.5f)
+	, MaxSpatialHashListenerRange(0.0f)
+	, NextSpatialHashUpdateTime(0.0f)
 {
 	if (HasAnyFlags(RF_ClassDefaultObject) == false)
 	{
@@ -164,6 +181,234 @@ FORCEINLINE_DEBUGGABLE float UAISense_Sight_VR::CalcQueryImportance(const FPerce
 		: FMath::Clamp((SightLimitQueryImportance - MaxQueryImportance) / SightRadiusSq * DistanceSq + MaxQueryImportance, 0.f, MaxQueryImportance);
 }
 
+FORCEINLINE void UAISense_Sight_VR::SetSightQueryIndex(bool bInRange, int32 Index)
+{
+	const FAISightQueryVR& SightQuery = (bInRange ? SightQueriesInRange : SightQueriesOutOfRange)[Index];
+	SightQueryIndices.Add(GetSightQueryKey(SightQuery.ObserverId, SightQuery.TargetId), (Index << 1) | (bInRange ? 1 : 0));
+}
+
+void UAISense_Sight_VR::SightQueryHeapSiftUp(bool bInRange, int32 Index)
+{
+	TArray<FAISightQueryVR>& SightQueries = bInRange ? SightQueriesInRange : SightQueriesOutOfRange;
+	const FAISightQueryVR::FHeapPredicate HeapPredicate;
+	const FAISightQueryVR MovingQuery = SightQueries[Index];
+
+	while (Index > 0)
+	{
+		const int32 ParentIndex = (Index - 1) / 2;
+		if (!HeapPredicate(MovingQuery, SightQueries[ParentIndex]))
+			break;
+
+		SightQueries[Index] = SightQueries[ParentIndex];
+		SetSightQueryIndex(bInRange, Index);
+		Index = ParentIndex;
+	}
+
+	SightQueries[Index] = MovingQuery;
+	SetSightQueryIndex(bInRange, Index);
+}
+
+void UAISense_Sight_VR::SightQueryHeapSiftDown(bool bInRange, int32 Index)
+{
+	TArray<FAISightQueryVR>& SightQueries = bInRange ? SightQueriesInRange : SightQueriesOutOfRange;
+	const FAISightQueryVR::FHeapPredicate HeapPredicate;
+	const FAISightQueryVR MovingQuery = SightQueries[Index];
+	const int32 NumQueries = SightQueries.Num();
+
+	for (;;)
+	{
+		int32 ChildIndex = Index * 2 + 1;
+		if (ChildIndex >= NumQueries)
+			break;
+
+		// Take the higher priority of the two children
+		if (ChildIndex + 1 < NumQueries && HeapPredicate(SightQueries[ChildIndex + 1], SightQueries[ChildIndex]))
+		{
+			++ChildIndex;
+		}
+
+		if (!HeapPredicate(SightQueries[ChildIndex], MovingQuery))
+			break;
+
+		SightQueries[Index] = SightQueries[ChildIndex];
+		SetSightQueryIndex(bInRange, Index);
+		Index = ChildIndex;
+	}
+
+	SightQueries[Index] = MovingQuery;
+	SetSightQueryIndex(bInRange, Index);
+}
+
+void UAISense_Sight_VR::SightQueryHeapPush(bool bInRange, const FAISightQueryVR& SightQuery)
+{
+	TArray<FAISightQueryVR>& SightQueries = bInRange ? SightQueriesInRange : SightQueriesOutOfRange;
+	SightQueries.Add(SightQuery);
+	SightQueryHeapSiftUp(bInRange, SightQueries.Num() - 1);
+}
+
+void UAISense_Sight_VR::SightQueryHeapPop(bool bInRange, FAISightQueryVR& OutSightQuery)
+{
+	TArray<FAISightQueryVR>& SightQueries = bInRange ? SightQueriesInRange : SightQueriesOutOfRange;
+	OutSightQuery = SightQueries[0];
+	SightQueryIndices.Remove(GetSightQueryKey(OutSightQuery.ObserverId, OutSightQuery.TargetId));
+
+	const FAISightQueryVR LastQuery = SightQueries.Pop(/*bAllowShrinking=*/false);
+	if (SightQueries.Num() > 0)
+	{
+		SightQueries[0] = LastQuery;
+		SightQueryHeapSiftDown(bInRange, 0);
+	}
+}
+
+void UAISense_Sight_VR::RebuildSightQueryHeaps()
+{
+	if (!bSightQueriesOutOfRangeDirty && !bSightQueriesInRangeDirty)
+	{
+		return;
+	}
+
+	if (bSightQueriesOutOfRangeDirty)
+	{
+		SightQueriesOutOfRange.Heapify(FAISightQueryVR::FHeapPredicate());
+		bSightQueriesOutOfRangeDirty = false;
+	}
+
+	if (bSightQueriesInRangeDirty)
+	{
+		SightQueriesInRange.Heapify(FAISightQueryVR::FHeapPredicate());
+		bSightQueriesInRangeDirty = false;
+	}
+
+	SightQueryIndices.Reset();
+	SightQueryIndices.Reserve(SightQueriesInRange.Num() + SightQueriesOutOfRange.Num());
+
+	for (int32 Index = 0; Index < SightQueriesInRange.Num(); ++Index)
+	{
+		SetSightQueryIndex(true, Index);
+	}
+
+	for (int32 Index = 0; Index < SightQueriesOutOfRange.Num(); ++Index)
+	{
+		SetSightQueryIndex(false, Index);
+	}
+}
+
+const FAISightQueryVR* UAISense_Sight_VR::FindSightQuery(const FPerceptionListenerID& ObserverId, FAISightTargetVR::FTargetId TargetId) const
+{
+	if (!bSightQueriesOutOfRangeDirty && !bSightQueriesInRangeDirty)
+	{
+		const int32* EncodedIndex = SightQueryIndices.Find(GetSightQueryKey(ObserverId, TargetId));
+		if (EncodedIndex == nullptr)
+		{
+			return nullptr;
+		}
+
+		return &((*EncodedIndex & 1) ? SightQueriesInRange : SightQueriesOutOfRange)[*EncodedIndex >> 1];
+	}
+
+	// Queries were added or removed since the last update, the index is rebuilt along with the heaps
+	auto IsPair = [&ObserverId, TargetId](const FAISightQueryVR& SightQuery)
+	{
+		return SightQuery.ObserverId == ObserverId && SightQuery.TargetId == TargetId;
+	};
+
+	if (const FAISightQueryVR* SightQuery = SightQueriesInRange.FindByPredicate(IsPair))
+	{
+		return SightQuery;
+	}
+
+	return SightQueriesOutOfRange.FindByPredicate(IsPair);
+}
+
+FAISightQueryVR* UAISense_Sight_VR::FindSightQuery(const FPerceptionListenerID& ObserverId, FAISightTargetVR::FTargetId TargetId)
+{
+	return const_cast<FAISightQueryVR*>(static_cast<const UAISense_Sight_VR*>(this)->FindSightQuery(ObserverId, TargetId));
+}
+
+FIntPoint UAISense_Sight_VR::GetSpatialHashCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / SightSpatialHashCellSize), FMath::FloorToInt(Location.Y / SightSpatialHashCellSize));
+}
+
+template <typename IdType>
+bool UAISense_Sight_VR::UpdateSpatialHashEntry(TMap<FIntPoint, TArray<IdType>>& Cells, TMap<IdType, FIntPoint>& Lookup, const IdType& Id, const FVector& Location)
+{
+	const FIntPoint NewCell = GetSpatialHashCell(Location);
+	FIntPoint* CurrentCell = Lookup.Find(Id);
+
+	if (CurrentCell && *CurrentCell == NewCell)
+	{
+		return false;
+	}
+
+	if (CurrentCell)
+	{
+		if (TArray<IdType>* OldCellEntries = Cells.Find(*CurrentCell))
+		{
+			OldCellEntries->RemoveSingleSwap(Id, false);
+			if (OldCellEntries->Num() == 0)
+			{
+				Cells.Remove(*CurrentCell);
+			}
+		}
+
+		*CurrentCell = NewCell;
+	}
+	else
+	{
+		Lookup.Add(Id, NewCell);
+	}
+
+	Cells.FindOrAdd(NewCell).Add(Id);
+	return true;
+}
+
+template <typename IdType>
+void UAISense_Sight_VR::RemoveSpatialHashEntry(TMap<FIntPoint, TArray<IdType>>& Cells, TMap<IdType, FIntPoint>& Lookup, const IdType& Id)
+{
+	FIntPoint CurrentCell;
+	if (Lookup.RemoveAndCopyValue(Id, CurrentCell))
+	{
+		if (TArray<IdType>* CellEntries = Cells.Find(CurrentCell))
+		{
+			CellEntries->RemoveSingleSwap(Id, false);
+			if (CellEntries->Num() == 0)
+			{
+				Cells.Remove(CurrentCell);
+			}
+		}
+	}
+}
+
+template <typename FuncType>
+void UAISense_Sight_VR::ForEachSpatialHashCell(const FVector& Location, float Range, const FuncType& Func) const
+{
+	const FIntPoint MinCell = GetSpatialHashCell(Location - FVector(Range, Range, 0.0f));
+	const FIntPoint MaxCell = GetSpatialHashCell(Location + FVector(Range, Range, 0.0f));
+
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			Func(FIntPoint(CellX, CellY));
+		}
+	}
+}
+
+float UAISense_Sight_VR::GetSpatialHashListenerRange(const FDigestedSightProperties& PropDigest) const
+{
+	// Pad by the most that a pair can close in on each other without either of them changing cells
+	return FMath::Sqrt(FMath::Max(PropDigest.SightRadiusSq, PropDigest.LoseSightRadiusSq)) + (SightSpatialHashCellSize * SightSpatialHashDriftCells);
+}
+
+bool UAISense_Sight_VR::IsInSightSpatialHashRange(const FPerceptionListener& Listener, const FDigestedSightProperties& PropDigest, const FVector& TargetLocation) const
+{
+	if (!bUseSightSpatialHash)
+		return true;
+
+	return FVector::DistSquared2D(Listener.CachedLocation, TargetLocation) <= FMath::Square(GetSpatialHashListenerRange(PropDigest));
+}
+
 void UAISense_Sight_VR::PostInitProperties()
 {
 	Super::PostInitProperties();
@@ -206,41 +451,252 @@ bool UAISense_Sight_VR::ShouldAutomaticallySeeTarget(const FDigestedSightPropert
 	return false;
 }
 
+void UAISense_Sight_VR::OnLineOfSightResult(FPerceptionListener& Listener, FAISightQueryVR& SightQuery, AActor* TargetActor, const FVector& TargetLocation, bool bVisible, EVRSightBodyPart SeenBodyPart)
+{
+	if (bVisible)
+	{
+		Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 1.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingSucceeded, GetSightBodyPartTag(SeenBodyPart)));
+		SightQuery.bLastResult = true;
+		SightQuery.LastSeenLocation = TargetLocation;
+		SightQuery.LastSeenBodyPart = SeenBodyPart;
+	}
+	// communicate failure only if we've seen give actor before
+	else if (SightQuery.bLastResult == true)
+	{
+		Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
+		SightQuery.bLastResult = false;
+		SightQuery.LastSeenLocation = FAISystem::InvalidLocation;
+		SightQuery.LastSeenBodyPart = EVRSightBodyPart::None;
+	}
+
+	if (SightQuery.bLastResult == false)
+	{
+		SIGHT_LOG_LOCATIONVR(Listener.Listener->GetOwner(), TargetLocation, 25.f, FColor::Red, TEXT(""));
+	}
+}
+
+FName UAISense_Sight_VR::GetSightBodyPartTag(EVRSightBodyPart BodyPart)
+{
+	static const FName HeadTag(TEXT("Head"));
+	static const FName LeftHandTag(TEXT("LeftHand"));
+	static const FName RightHandTag(TEXT("RightHand"));
+	static const FName BodyTag(TEXT("Body"));
+
+	switch (BodyPart)
+	{
+	case EVRSightBodyPart::Head: return HeadTag; break;
+	case EVRSightBodyPart::LeftHand: return LeftHandTag; break;
+	case EVRSightBodyPart::RightHand: return RightHandTag; break;
+	case EVRSightBodyPart::Body: return BodyTag; break;
+	case EVRSightBodyPart::None:
+	default: return NAME_None; break;
+	}
+}
+
+void UAISense_Sight_VR::GatherSightPoints(const AActor* TargetActor, const FVector& TargetLocation, EVRSightBodyPart PreferredBodyPart, FSightPointsVR& OutSightPoints) const
+{
+	const AVRBaseCharacter* VRChar = bUseVRBodyVisibilityProfile ? Cast<const AVRBaseCharacter>(TargetActor) : nullptr;
+
+	if (!VRChar)
+	{
+		OutSightPoints.Emplace(TargetLocation, EVRSightBodyPart::None);
+		return;
+	}
+
+	if (VRChar->VRReplicatedCamera)
+	{
+		OutSightPoints.Emplace(VRChar->VRReplicatedCamera->GetComponentLocation(), EVRSightBodyPart::Head);
+	}
+
+	if (VRChar->LeftMotionController)
+	{
+		OutSightPoints.Emplace(VRChar->LeftMotionController->GetComponentLocation(), EVRSightBodyPart::LeftHand);
+	}
+
+	if (VRChar->RightMotionController)
+	{
+		OutSightPoints.Emplace(VRChar->RightMotionController->GetComponentLocation(), EVRSightBodyPart::RightHand);
+	}
+
+	OutSightPoints.Emplace(TargetLocation, EVRSightBodyPart::Body);
+
+	// Whatever we saw last time is the most likely to still be visible, so check it first
+	if (PreferredBodyPart != EVRSightBodyPart::None)
+	{
+		for (int32 i = 1; i < OutSightPoints.Num(); ++i)
+		{
+			if (OutSightPoints[i].BodyPart == PreferredBodyPart)
+			{
+				OutSightPoints.Swap(0, i);
+				break;
+			}
+		}
+	}
+}
+
+EVRSightBodyPart UAISense_Sight_VR::GetLastSeenBodyPart(UAIPerceptionComponent* Listener, AActor* Target) const
+{
+	if (!Listener || !Target)
+	{
+		return EVRSightBodyPart::None;
+	}
+
+	const FAISightQueryVR* SightQuery = FindSightQuery(Listener->GetListenerId(), Target->GetUniqueID());
+	return (SightQuery && SightQuery->bLastResult) ? SightQuery->LastSeenBodyPart : EVRSightBodyPart::None;
+}
+
+int32 UAISense_Sight_VR::SubmitSightPointTraces(UWorld* World, FPendingSightTraceVR& PendingTrace, const FVector& ObserverLocation, const AActor* IgnoreActor, int32 FirstIndex, int32 Count) const
+{
+	const FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(AILineOfSight), true, IgnoreActor);
+	const int32 LastIndex = FMath::Min(FirstIndex + Count, PendingTrace.SightPoints.Num());
+
+	for (int32 i = FirstIndex; i < LastIndex; ++i)
+	{
+		FSightPointVR& SightPoint = PendingTrace.SightPoints[i];
+		SightPoint.TraceHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, ObserverLocation, SightPoint.Location
+			, DefaultSightCollisionChannel
+			, TraceParams);
+		SightPoint.bSubmitted = true;
+	}
+
+	const int32 NumSubmitted = FMath::Max(LastIndex - FirstIndex, 0);
+	INC_DWORD_STAT_BY(STAT_AI_Sense_Sight_AsyncTracesSubmitted, NumSubmitted);
+	return NumSubmitted;
+}
+
+int32 UAISense_Sight_VR::ProcessAsyncSightTraces(UWorld* World)
+{
+	if (PendingAsyncSightTraces.Num() < 1)
+	{
+		return 0;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight_ProcessAsyncTraces);
+
+	AIPerception::FListenerMap& ListenersMap = *GetListeners();
+	int32 NumTracesSubmitted = 0;
+
+	for (auto It = PendingAsyncSightTraces.CreateIterator(); It; ++It)
+	{
+		FPendingSightTraceVR& PendingTrace = It.Value();
+		const FAISightTargetVR* Target = ObservedTargets.Find(PendingTrace.TargetId);
+		AActor* TargetActor = Target ? Target->Target.Get() : nullptr;
+
+		if (!TargetActor)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		bool bAllFinished = true;
+		bool bDropped = false;
+		for (FSightPointVR& SightPoint : PendingTrace.SightPoints)
+		{
+			if (!SightPoint.bSubmitted || SightPoint.bFinished)
+				continue;
+
+			FTraceDatum TraceDatum;
+			if (World->QueryTraceData(SightPoint.TraceHandle, TraceDatum))
+			{
+				SightPoint.bFinished = true;
+				SightPoint.bVisible = true;
+				for (const FHitResult& HitResult : TraceDatum.OutHits)
+				{
+					if (HitResult.bBlockingHit)
+					{
+						AActor* HitResultActor = HitResult.Actor.Get();
+						SightPoint.bVisible = HitResultActor ? HitResultActor->IsOwnedBy(TargetActor) : false;
+						break;
+					}
+				}
+			}
+			else if (!World->IsTraceHandleValid(SightPoint.TraceHandle, false))
+			{
+				// Trace data was dropped (level change / frame skipped), the query will just get re-submitted
+				bDropped = true;
+				break;
+			}
+			else
+			{
+				bAllFinished = false;
+			}
+		}
+
+		if (bDropped)
+		{
+			It.RemoveCurrent();
+		}
+		else if (bAllFinished)
+		{
+			// Results don't change the heap keys, so they are written straight into the query found through the pair index
+			FAISightQueryVR* SightQuery = FindSightQuery(PendingTrace.ObserverId, PendingTrace.TargetId);
+			FPerceptionListener* Listener = ListenersMap.Find(PendingTrace.ObserverId);
+
+			if (SightQuery && Listener && Listener->Listener.IsValid())
+			{
+				// Points are in preference order, take the first one that was visible
+				const FSightPointVR* SeenPoint = PendingTrace.SightPoints.FindByPredicate([](const FSightPointVR& SightPoint) { return SightPoint.bVisible; });
+
+				if (SeenPoint)
+				{
+					// Any points we hadn't submitted yet are never traced
+					OnLineOfSightResult(*Listener, *SightQuery, TargetActor, SeenPoint->Location, true, SeenPoint->BodyPart);
+				}
+				else
+				{
+					const int32 FirstUnsubmitted = PendingTrace.SightPoints.IndexOfByPredicate([](const FSightPointVR& SightPoint) { return !SightPoint.bSubmitted; });
+
+					if (FirstUnsubmitted != INDEX_NONE)
+					{
+						// The preferred point wasn't visible, fan out to the rest of them and keep the pair pending
+						NumTracesSubmitted += SubmitSightPointTraces(World, PendingTrace, Listener->CachedLocation, Listener->Listener->GetBodyActor(), FirstUnsubmitted, PendingTrace.SightPoints.Num() - FirstUnsubmitted);
+						continue;
+					}
+
+					OnLineOfSightResult(*Listener, *SightQuery, TargetActor, PendingTrace.TargetLocation, false);
+				}
+			}
+
+			It.RemoveCurrent();
+		}
+	}
+
+	return NumTracesSubmitted;
+}
+
 float UAISense_Sight_VR::Update()
 {
 	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight);
 
-	const UWorld* World = GEngine->GetWorldFromContextObject(GetPerceptionSystem()->GetOuter(), EGetWorldErrorMode::LogAndReturnNull);
+	UWorld* World = GEngine->GetWorldFromContextObject(GetPerceptionSystem()->GetOuter(), EGetWorldErrorMode::LogAndReturnNull);
 
 	if (World == NULL)
 	{
 		return SuspendNextUpdate;
 	}
 
-	// sort Sight Queries
+	// Re-bucket targets and listeners and drop / create queries as pairs move in and out of range
+	if (bUseSightSpatialHash && World->GetTimeSeconds() >= NextSpatialHashUpdateTime)
 	{
-		auto RecalcScore = [](FAISightQueryVR& SightQuery)->EForEachResult
-		{
-			SightQuery.RecalcScore();
-			return EForEachResult::Continue;
-		};
+		UpdateSightSpatialHash();
+		NextSpatialHashUpdateTime = World->GetTimeSeconds() + SightSpatialHashUpdateInterval;
+	}
 
+	// Rebuild the query heaps and their pair index, only needed after queries were added or removed outside of the update
+	{
 		SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight_UpdateSort);
-		// Sort out of range queries
-		if (bSightQueriesOutOfRangeDirty)
-		{
-			ForEach(SightQueriesOutOfRange, RecalcScore);
-			SightQueriesOutOfRange.Sort(FAISightQueryVR::FSortPredicate());
-			NextOutOfRangeIndex = 0;
-			bSightQueriesOutOfRangeDirty = false;
-		}
-
-		// Sort in range queries
-		ForEach(SightQueriesInRange, RecalcScore);
-		SightQueriesInRange.Sort(FAISightQueryVR::FSortPredicate());
+		RebuildSightQueryHeaps();
 	}
 
+	// Apply the results of last updates async traces before the queries get re-scored, the pair index is valid from here on
+	// Follow up traces from the pending pairs count against this updates budget
 	int32 TracesCount = 0;
+	if (bUseAsyncSightTraces)
+	{
+		TracesCount = ProcessAsyncSightTraces(World);
+	}
+
+	const int32 MaxTracesThisTick = bUseAsyncSightTraces ? MaxAsyncTracesPerTick : MaxTracesPerTick;
 	int32 NumQueriesProcessed = 0;
 	double TimeSliceEnd = FPlatformTime::Seconds() + MaxTimeSlicePerTick;
 	bool bHitTimeSliceLimit = false;
@@ -250,45 +706,18 @@ float UAISense_Sight_VR::Update()
 	double LastTime = FPlatformTime::Seconds();
 #endif // AISENSE_SIGHT_TIMESLICING_DEBUG
 	static const int32 InitialInvalidItemsSize = 16;
-	enum class EOperationType : uint8
-	{
-		Remove,
-		SwapList
-	};
-	struct FQueryOperation
-	{
-		FQueryOperation(bool bInInRange, EOperationType InOpType, int32 InIndex) : bInRange(bInInRange), OpType(InOpType), Index(InIndex) {}
-		bool bInRange;
-		EOperationType OpType;
-		int32 Index;
-	};
-	TArray<FQueryOperation> QueryOperations;
 	TArray<FAISightTargetVR::FTargetId> InvalidTargets;
-	QueryOperations.Reserve(InitialInvalidItemsSize);
 	InvalidTargets.Reserve(InitialInvalidItemsSize);
 
+	// Queries are popped off of the heaps as they are processed and pushed back once we are done so that
+	// none of them get processed twice in the same update
+	ProcessedSightQueries.Reset();
+
 	AIPerception::FListenerMap& ListenersMap = *GetListeners();
+	const FAISightQueryVR::FHeapPredicate HeapPredicate;
 
-	int32 InRangeItr = 0;
-	int32 OutOfRangeItr = 0;
-	for (int32 QueryIndex = 0; QueryIndex < SightQueriesInRange.Num() + SightQueriesOutOfRange.Num(); ++QueryIndex)
+	while (SightQueriesInRange.Num() + SightQueriesOutOfRange.Num() > 0)
 	{
-		// Calculate next in range query
-		int32 InRangeIndex = SightQueriesInRange.IsValidIndex(InRangeItr) ? InRangeItr : INDEX_NONE;
-		FAISightQueryVR* InRangeQuery = InRangeIndex != INDEX_NONE ? &SightQueriesInRange[InRangeIndex] : nullptr;
-
-		// Calculate next out of range query
-		int32 OutOfRangeIndex = SightQueriesOutOfRange.IsValidIndex(OutOfRangeItr) ? (NextOutOfRangeIndex + OutOfRangeItr) % SightQueriesOutOfRange.Num() : INDEX_NONE;
-		FAISightQueryVR* OutOfRangeQuery = OutOfRangeIndex != INDEX_NONE ? &SightQueriesOutOfRange[OutOfRangeIndex] : nullptr;
-		if (OutOfRangeQuery)
-		{
-			OutOfRangeQuery->RecalcScore();
-		}
-
-		// Compare to real find next query
-		const bool bIsInRangeQuery = (InRangeQuery && OutOfRangeQuery) ? FAISightQueryVR::FSortPredicate()(*InRangeQuery, *OutOfRangeQuery) : !OutOfRangeQuery;
-		FAISightQueryVR* SightQuery = bIsInRangeQuery ? InRangeQuery : OutOfRangeQuery;
-
 		// Time slice limit check - spread out checks to every N queries so we don't spend more time checking timer than doing work
 		NumQueriesProcessed++;
 #ifdef AISENSE_SIGHT_TIMESLICING_DEBUG
@@ -297,13 +726,18 @@ float UAISense_Sight_VR::Update()
 #endif // AISENSE_SIGHT_TIMESLICING_DEBUG
 		if (bHitTimeSliceLimit == false && (NumQueriesProcessed % MinQueriesPerTimeSliceCheck) == 0 && FPlatformTime::Seconds() > TimeSliceEnd)
 		{
+			// Queries no longer need to be aged each update as the heap key doesn't change with time, so we can stop here
 			bHitTimeSliceLimit = true;
-			// do not break here since that would bypass queue aging
 		}
 
-		if (TracesCount < MaxTracesPerTick && bHitTimeSliceLimit == false)
+		if (TracesCount < MaxTracesThisTick && bHitTimeSliceLimit == false)
 		{
-			bIsInRangeQuery ? ++InRangeItr : ++OutOfRangeItr;
+			// Take the highest priority query of the two heaps
+			const bool bIsInRangeQuery = SightQueriesInRange.Num() > 0 && (SightQueriesOutOfRange.Num() == 0 || HeapPredicate(SightQueriesInRange.HeapTop(), SightQueriesOutOfRange.HeapTop()));
+
+			FAISightQueryVR SightQueryData;
+			SightQueryHeapPop(bIsInRangeQuery, SightQueryData);
+			FAISightQueryVR* SightQuery = &SightQueryData;
 
 			FPerceptionListener& Listener = ListenersMap[SightQuery->ObserverId];
 
@@ -348,6 +782,7 @@ float UAISense_Sight_VR::Update()
 							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, StimulusStrength, OutSeenLocation, Listener.CachedLocation));
 							SightQuery->bLastResult = true;
 							SightQuery->LastSeenLocation = OutSeenLocation;
+							SightQuery->LastSeenBodyPart = EVRSightBodyPart::None; // The interface doesn't tell us what it saw
 						}
 						// communicate failure only if we've seen give actor before
 						else if (SightQuery->bLastResult == true)
@@ -355,6 +790,7 @@ float UAISense_Sight_VR::Update()
 							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
 							SightQuery->bLastResult = false;
 							SightQuery->LastSeenLocation = FAISystem::InvalidLocation;
+							SightQuery->LastSeenBodyPart = EVRSightBodyPart::None;
 						}
 
 						if (SightQuery->bLastResult == false)
@@ -364,39 +800,68 @@ float UAISense_Sight_VR::Update()
 
 						TracesCount += NumberOfLoSChecksPerformed;
 					}
+					else if (bUseAsyncSightTraces)
+					{
+						// Submit the traces and pick up the results on the next update, skip if this pair already has some in flight
+						const uint64 QueryKey = GetSightQueryKey(SightQuery->ObserverId, SightQuery->TargetId);
+						if (!PendingAsyncSightTraces.Contains(QueryKey))
+						{
+							FPendingSightTraceVR& PendingTrace = PendingAsyncSightTraces.Add(QueryKey);
+							PendingTrace.TargetLocation = TargetLocation;
+							PendingTrace.ObserverId = SightQuery->ObserverId;
+							PendingTrace.TargetId = SightQuery->TargetId;
+							GatherSightPoints(TargetActor, TargetLocation, SightQuery->LastSeenBodyPart, PendingTrace.SightPoints);
+
+							// Only the preferred point goes out now, the rest only get traced if it turns out to be hidden
+							TracesCount += SubmitSightPointTraces(World, PendingTrace, Listener.CachedLocation, ListenerPtr->GetBodyActor(), 0, 1);
+						}
+					}
 					else
 					{
 						// we need to do tests ourselves
-						FHitResult HitResult;
-						const bool bHit = World->LineTraceSingleByChannel(HitResult, Listener.CachedLocation, TargetLocation
-							, DefaultSightCollisionChannel
-							, FCollisionQueryParams(SCENE_QUERY_STAT(AILineOfSight), true, ListenerPtr->GetBodyActor()));
-
-						++TracesCount;
+						FSightPointsVR SightPoints;
+						GatherSightPoints(TargetActor, TargetLocation, SightQuery->LastSeenBodyPart, SightPoints);
 
-						auto HitResultActorIsOwnedByTargetActor = [&HitResult, TargetActor]()
+						const FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(AILineOfSight), true, ListenerPtr->GetBodyActor());
+						const FSightPointVR* SeenPoint = nullptr;
+						bool bOutOfTraces = false;
+						for (const FSightPointVR& SightPoint : SightPoints)
 						{
-							AActor* HitResultActor = HitResult.Actor.Get();
-							return (HitResultActor ? HitResultActor->IsOwnedBy(TargetActor) : false);
-						};
-
-						if (bHit == false || HitResultActorIsOwnedByTargetActor())
-						{
-							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 1.f, TargetLocation, Listener.CachedLocation));
-							SightQuery->bLastResult = true;
-							SightQuery->LastSeenLocation = TargetLocation;
+							// Each point is its own trace, stop once we are over budget and finish the query next time
+							if (TracesCount >= MaxTracesThisTick)
+							{
+								bOutOfTraces = true;
+								break;
+							}
+
+							FHitResult HitResult;
+							const bool bHit = World->LineTraceSingleByChannel(HitResult, Listener.CachedLocation, SightPoint.Location
+								, DefaultSightCollisionChannel
+								, TraceParams);
+
+							++TracesCount;
+
+							auto HitResultActorIsOwnedByTargetActor = [&HitResult, TargetActor]()
+							{
+								AActor* HitResultActor = HitResult.Actor.Get();
+								return (HitResultActor ? HitResultActor->IsOwnedBy(TargetActor) : false);
+							};
+
+							// Early out on the first visible point
+							if (bHit == false || HitResultActorIsOwnedByTargetActor())
+							{
+								SeenPoint = &SightPoint;
+								break;
+							}
 						}
-						// communicate failure only if we've seen give actor before
-						else if (SightQuery->bLastResult == true)
+
+						if (SeenPoint)
 						{
-							Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
-							SightQuery->bLastResult = false;
-							SightQuery->LastSeenLocation = FAISystem::InvalidLocation;
+							OnLineOfSightResult(Listener, *SightQuery, TargetActor, SeenPoint->Location, true, SeenPoint->BodyPart);
 						}
-
-						if (SightQuery->bLastResult == false)
+						else if (!bOutOfTraces)
 						{
-							SIGHT_LOG_LOCATIONVR(ListenerPtr->GetOwner(), TargetLocation, 25.f, FColor::Red, TEXT(""));
+							OnLineOfSightResult(Listener, *SightQuery, TargetActor, TargetLocation, false);
 						}
 					}
 				}
@@ -406,22 +871,18 @@ float UAISense_Sight_VR::Update()
 					SIGHT_LOG_SEGMENTVR(ListenerPtr->GetOwner(), Listener.CachedLocation, TargetLocation, FColor::Red, TEXT("%s"), *(Target.TargetId.ToString()));
 					Listener.RegisterStimulus(TargetActor, FAIStimulus(*this, 0.f, TargetLocation, Listener.CachedLocation, FAIStimulus::SensingFailed));
 					SightQuery->bLastResult = false;
+					SightQuery->LastSeenBodyPart = EVRSightBodyPart::None;
 				}
 
 				SightQuery->Importance = CalcQueryImportance(Listener, TargetLocation, SightRadiusSq);
-				const bool bShouldBeInRange = SightQuery->Importance > 0.0f;
-				if (bIsInRangeQuery != bShouldBeInRange)
-				{
-					QueryOperations.Add(FQueryOperation(bIsInRangeQuery, EOperationType::SwapList, bIsInRangeQuery ? InRangeIndex : OutOfRangeIndex));
-				}
 
 				// restart query
 				SightQuery->OnProcessed();
+				ProcessedSightQueries.Add(*SightQuery);
 			}
 			else
 			{
-				// put this index to "to be removed" array
-				QueryOperations.Add(FQueryOperation(bIsInRangeQuery, EOperationType::Remove, bIsInRangeQuery ? InRangeIndex : OutOfRangeIndex));
+				// Not pushing it back removes it
 				if (TargetActor == nullptr)
 				{
 					InvalidTargets.AddUnique(SightQuery->TargetId);
@@ -434,7 +895,13 @@ float UAISense_Sight_VR::Update()
 		}
 	}
 
-	NextOutOfRangeIndex = SightQueriesOutOfRange.Num() > 0 ? (NextOutOfRangeIndex + OutOfRangeItr) % SightQueriesOutOfRange.Num() : 0;
+	// Re-insert the processed queries, this is also where they swap between in range and out of range
+	for (const FAISightQueryVR& ProcessedQuery : ProcessedSightQueries)
+	{
+		SightQueryHeapPush(ProcessedQuery.Importance > 0.0f, ProcessedQuery);
+	}
+
+	ProcessedSightQueries.Reset();
 
 #ifdef AISENSE_SIGHT_TIMESLICING_DEBUG
 	UE_LOG(LogAIPerceptionVR, VeryVerbose, TEXT("UAISense_Sight_VR::Update processed %d sources in %f seconds [time slice limited? %d]"), NumQueriesProcessed, TimeSpent, bHitTimeSliceLimit ? 1 : 0);
@@ -442,69 +909,22 @@ float UAISense_Sight_VR::Update()
 	UE_LOG(LogAIPerceptionVR, VeryVerbose, TEXT("UAISense_Sight_VR::Update processed %d sources [time slice limited? %d]"), NumQueriesProcessed, bHitTimeSliceLimit ? 1 : 0);
 #endif // AISENSE_SIGHT_TIMESLICING_DEBUG
 
-	if (QueryOperations.Num() > 0)
+	if (InvalidTargets.Num() > 0)
 	{
-		// Sort by InRange and by descending Index 
-		QueryOperations.Sort([](const FQueryOperation& LHS, const FQueryOperation& RHS)->bool
-			{
-				if (LHS.bInRange != RHS.bInRange)
-					return LHS.bInRange;
-				return LHS.Index > RHS.Index;
-			});
-		// Do all the removes first and save the out of range swaps because we will insert them at the right location to prevent sorting
-		TArray<FAISightQueryVR> SightQueriesOutOfRangeToInsert;
-		for (FQueryOperation& Operation : QueryOperations)
-		{
-			if (Operation.OpType == EOperationType::SwapList)
-			{
-				if (Operation.bInRange)
-				{
-					SightQueriesOutOfRangeToInsert.Push(SightQueriesInRange[Operation.Index]);
-				}
-				else
-				{
-					SightQueriesInRange.Add(SightQueriesOutOfRange[Operation.Index]);
-				}
-			}
+		// this should not be happening since UAIPerceptionSystem::OnPerceptionStimuliSourceEndPlay introduction
+		UE_VLOG(GetPerceptionSystem(), LogAIPerceptionVR, Error, TEXT("Invalid sight targets found during UAISense_Sight_VR::Update call"));
 
-			if (Operation.bInRange)
-			{
-				// In range queries are always sorted at the beginning of the update
-				SightQueriesInRange.RemoveAtSwap(Operation.Index, 1, /*bAllowShrinking*/false);
-			}
-			else
-			{
-				// Preserve the list ordered
-				SightQueriesOutOfRange.RemoveAt(Operation.Index, 1, /*bAllowShrinking*/false);
-				if (Operation.Index < NextOutOfRangeIndex)
-				{
-					NextOutOfRangeIndex--;
-				}
-			}
-		}
-		// Reinsert the saved out of range swaps
-		if (SightQueriesOutOfRangeToInsert.Num() > 0)
+		for (const auto& TargetId : InvalidTargets)
 		{
-			SightQueriesOutOfRange.Insert(SightQueriesOutOfRangeToInsert.GetData(), SightQueriesOutOfRangeToInsert.Num(), NextOutOfRangeIndex);
-			NextOutOfRangeIndex += SightQueriesOutOfRangeToInsert.Num();
+			// remove affected queries
+			RemoveAllQueriesToTarget(TargetId);
+			// remove target itself
+			ObservedTargets.Remove(TargetId);
+			RemoveSpatialHashEntry(SpatialHashTargetCells, SpatialHashTargetLookup, TargetId);
 		}
 
-		if (InvalidTargets.Num() > 0)
-		{
-			// this should not be happening since UAIPerceptionSystem::OnPerceptionStimuliSourceEndPlay introduction
-			UE_VLOG(GetPerceptionSystem(), LogAIPerceptionVR, Error, TEXT("Invalid sight targets found during UAISense_Sight_VR::Update call"));
-
-			for (const auto& TargetId : InvalidTargets)
-			{
-				// remove affected queries
-				RemoveAllQueriesToTarget(TargetId);
-				// remove target itself
-				ObservedTargets.Remove(TargetId);
-			}
-
-			// remove holes
-			ObservedTargets.Compact();
-		}
+		// remove holes
+		ObservedTargets.Compact();
 	}
 
 	//return SightQueryQueue.Num() > 0 ? 1.f/6 : FLT_MAX;
@@ -526,6 +946,8 @@ void UAISense_Sight_VR::UnregisterSource(AActor& SourceActor)
 	const FAISightTargetVR::FTargetId AsTargetId = SourceActor.GetUniqueID();
 	FAISightTargetVR AsTarget;
 
+	RemoveSpatialHashEntry(SpatialHashTargetCells, SpatialHashTargetLookup, AsTargetId);
+
 	if (ObservedTargets.RemoveAndCopyValue(AsTargetId, AsTarget)
 		&& (SightQueriesInRange.Num() + SightQueriesOutOfRange.Num()) > 0)
 	{
@@ -556,7 +978,10 @@ void UAISense_Sight_VR::UnregisterSource(AActor& SourceActor)
 				return EReverseForEachResult::UnTouched;
 			};
 
-			ReverseForEach(SightQueriesInRange, RemoveQuery);
+			if (ReverseForEach(SightQueriesInRange, RemoveQuery) == EReverseForEachResult::Modified)
+			{
+				bSightQueriesInRangeDirty = true;
+			}
 			if (ReverseForEach(SightQueriesOutOfRange, RemoveQuery) == EReverseForEachResult::Modified)
 			{
 				bSightQueriesOutOfRangeDirty = true;
@@ -598,28 +1023,17 @@ bool UAISense_Sight_VR::RegisterTarget(AActor& TargetActor, const TFunction<void
 	const AVRBaseCharacter * VRChar = Cast<const AVRBaseCharacter>(&TargetActor);
 	const FVector TargetLocation = VRChar != nullptr ? VRChar->GetVRLocation_Inline() : TargetActor.GetActorLocation();
 
-	for (AIPerception::FListenerMap::TConstIterator ItListener(ListenersMap); ItListener; ++ItListener)
+	auto ConsiderListener = [&](const FPerceptionListener& Listener)
 	{
-		const FPerceptionListener& Listener = ItListener->Value;
 		const IGenericTeamAgentInterface* ListenersTeamAgent = Listener.GetTeamAgent();
 
 		if (Listener.HasSense(GetSenseID()) && Listener.GetBodyActor() != &TargetActor)
 		{
 			const FDigestedSightProperties& PropDigest = DigestedProperties[Listener.GetListenerID()];
-			if (FAISenseAffiliationFilter::ShouldSenseTeam(ListenersTeamAgent, TargetActor, PropDigest.AffiliationFlags))
+			if (FAISenseAffiliationFilter::ShouldSenseTeam(ListenersTeamAgent, TargetActor, PropDigest.AffiliationFlags) && IsInSightSpatialHashRange(Listener, PropDigest, TargetLocation))
 			{
 				// create a sight query		
-				const float Importance = CalcQueryImportance(ItListener->Value, TargetLocation, PropDigest.SightRadiusSq);
-				const bool bInRange = Importance > 0.0f;
-				if (!bInRange)
-				{
-					bSightQueriesOutOfRangeDirty = true;
-				}
-				FAISightQueryVR& AddedQuery = bInRange ? SightQueriesInRange.AddDefaulted_GetRef() : SightQueriesOutOfRange.AddDefaulted_GetRef();
-				AddedQuery.ObserverId = ItListener->Key;
-				AddedQuery.TargetId = SightTarget->TargetId;
-
-				AddedQuery.Importance = Importance;
+				FAISightQueryVR& AddedQuery = AddSightQuery(Listener, PropDigest, SightTarget->TargetId, TargetLocation);
 
 				if (OnAddedFunc)
 				{
@@ -628,6 +1042,32 @@ bool UAISense_Sight_VR::RegisterTarget(AActor& TargetActor, const TFunction<void
 				bNewQueriesAdded = true;
 			}
 		}
+	};
+
+	if (bUseSightSpatialHash)
+	{
+		// Only look at the listeners in the cells that could possibly see us
+		UpdateSpatialHashEntry(SpatialHashTargetCells, SpatialHashTargetLookup, SightTarget->TargetId, TargetLocation);
+		ForEachSpatialHashCell(TargetLocation, MaxSpatialHashListenerRange, [&](const FIntPoint& Cell)
+		{
+			if (const TArray<FPerceptionListenerID>* CellListeners = SpatialHashListenerCells.Find(Cell))
+			{
+				for (const FPerceptionListenerID& ListenerId : *CellListeners)
+				{
+					if (const FPerceptionListener* Listener = ListenersMap.Find(ListenerId))
+					{
+						ConsiderListener(*Listener);
+					}
+				}
+			}
+		});
+	}
+	else
+	{
+		for (AIPerception::FListenerMap::TConstIterator ItListener(ListenersMap); ItListener; ++ItListener)
+		{
+			ConsiderListener(ItListener->Value);
+		}
 	}
 
 	// sort Sight Queries
@@ -639,6 +1079,27 @@ bool UAISense_Sight_VR::RegisterTarget(AActor& TargetActor, const TFunction<void
 	return bNewQueriesAdded;
 }
 
+FAISightQueryVR& UAISense_Sight_VR::AddSightQuery(const FPerceptionListener& Listener, const FDigestedSightProperties& PropDigest, FAISightTargetVR::FTargetId TargetId, const FVector& TargetLocation)
+{
+	const float Importance = CalcQueryImportance(Listener, TargetLocation, PropDigest.SightRadiusSq);
+	const bool bInRange = Importance > 0.0f;
+	if (bInRange)
+	{
+		bSightQueriesInRangeDirty = true;
+	}
+	else
+	{
+		bSightQueriesOutOfRangeDirty = true;
+	}
+
+	FAISightQueryVR& AddedQuery = bInRange ? SightQueriesInRange.AddDefaulted_GetRef() : SightQueriesOutOfRange.AddDefaulted_GetRef();
+	AddedQuery.ObserverId = Listener.GetListenerID();
+	AddedQuery.TargetId = TargetId;
+	AddedQuery.Importance = Importance;
+
+	return AddedQuery;
+}
+
 void UAISense_Sight_VR::OnNewListenerImpl(const FPerceptionListener& NewListener)
 {
 	UAIPerceptionComponent* NewListenerPtr = NewListener.Listener.Get();
@@ -658,30 +1119,19 @@ void UAISense_Sight_VR::GenerateQueriesForListener(const FPerceptionListener& Li
 	const IGenericTeamAgentInterface* ListenersTeamAgent = Listener.GetTeamAgent();
 	const AActor* Avatar = Listener.GetBodyActor();
 
-	// create sight queries with all legal targets
-	for (FTargetsContainer::TConstIterator ItTarget(ObservedTargets); ItTarget; ++ItTarget)
+	auto ConsiderTarget = [&](const FAISightTargetVR& SightTarget)
 	{
-		const AActor* TargetActor = ItTarget->Value.GetTargetActor();
+		const AActor* TargetActor = SightTarget.GetTargetActor();
 		if (TargetActor == NULL || TargetActor == Avatar)
 		{
-			continue;
+			return;
 		}
 
-		if (FAISenseAffiliationFilter::ShouldSenseTeam(ListenersTeamAgent, *TargetActor, PropertyDigest.AffiliationFlags))
+		const FVector TargetLocation = SightTarget.GetLocationSimple();
+		if (FAISenseAffiliationFilter::ShouldSenseTeam(ListenersTeamAgent, *TargetActor, PropertyDigest.AffiliationFlags) && IsInSightSpatialHashRange(Listener, PropertyDigest, TargetLocation))
 		{
 			// create a sight query		
-			const float Importance = CalcQueryImportance(Listener, ItTarget->Value.GetLocationSimple(), PropertyDigest.SightRadiusSq);
-			const bool bInRange = Importance > 0.0f;
-			if (!bInRange)
-			{
-				bSightQueriesOutOfRangeDirty = true;
-			}
-			FAISightQueryVR& AddedQuery = bInRange ? SightQueriesInRange.AddDefaulted_GetRef() : SightQueriesOutOfRange.AddDefaulted_GetRef();
-			AddedQuery.ObserverId = Listener.GetListenerID();
-			AddedQuery.TargetId = ItTarget->Key;
-
-			AddedQuery.Importance = Importance;
-
+			FAISightQueryVR& AddedQuery = AddSightQuery(Listener, PropertyDigest, SightTarget.TargetId, TargetLocation);
 
 			if (OnAddedFunc)
 			{
@@ -689,6 +1139,36 @@ void UAISense_Sight_VR::GenerateQueriesForListener(const FPerceptionListener& Li
 			}
 			bNewQueriesAdded = true;
 		}
+	};
+
+	if (bUseSightSpatialHash)
+	{
+		// Only look at the targets in the cells that we could possibly see
+		const float ListenerRange = GetSpatialHashListenerRange(PropertyDigest);
+		MaxSpatialHashListenerRange = FMath::Max(MaxSpatialHashListenerRange, ListenerRange);
+		UpdateSpatialHashEntry(SpatialHashListenerCells, SpatialHashListenerLookup, Listener.GetListenerID(), Listener.CachedLocation);
+
+		ForEachSpatialHashCell(Listener.CachedLocation, ListenerRange, [&](const FIntPoint& Cell)
+		{
+			if (const TArray<FAISightTargetVR::FTargetId>* CellTargets = SpatialHashTargetCells.Find(Cell))
+			{
+				for (const FAISightTargetVR::FTargetId& TargetId : *CellTargets)
+				{
+					if (const FAISightTargetVR* SightTarget = ObservedTargets.Find(TargetId))
+					{
+						ConsiderTarget(*SightTarget);
+					}
+				}
+			}
+		});
+	}
+	else
+	{
+		// create sight queries with all legal targets
+		for (FTargetsContainer::TConstIterator ItTarget(ObservedTargets); ItTarget; ++ItTarget)
+		{
+			ConsiderTarget(ItTarget->Value);
+		}
 	}
 
 	// sort Sight Queries
@@ -698,6 +1178,149 @@ void UAISense_Sight_VR::GenerateQueriesForListener(const FPerceptionListener& Li
 	}
 }
 
+void UAISense_Sight_VR::UpdateSightSpatialHash()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight_SpatialHash);
+
+	AIPerception::FListenerMap& ListenersMap = *GetListeners();
+
+	// Move targets and listeners between cells, only the ones that changed cells need new pairs
+	TArray<FAISightTargetVR::FTargetId> MovedTargets;
+	for (FTargetsContainer::TConstIterator ItTarget(ObservedTargets); ItTarget; ++ItTarget)
+	{
+		if (ItTarget->Value.Target.IsValid() && UpdateSpatialHashEntry(SpatialHashTargetCells, SpatialHashTargetLookup, ItTarget->Key, ItTarget->Value.GetLocationSimple()))
+		{
+			MovedTargets.Add(ItTarget->Key);
+		}
+	}
+
+	TArray<FPerceptionListenerID> MovedListeners;
+	MaxSpatialHashListenerRange = 0.0f;
+	for (AIPerception::FListenerMap::TConstIterator ItListener(ListenersMap); ItListener; ++ItListener)
+	{
+		const FPerceptionListener& Listener = ItListener->Value;
+		const FDigestedSightProperties* PropDigest = DigestedProperties.Find(ItListener->Key);
+
+		if (!PropDigest || !Listener.HasSense(GetSenseID()))
+			continue;
+
+		MaxSpatialHashListenerRange = FMath::Max(MaxSpatialHashListenerRange, GetSpatialHashListenerRange(*PropDigest));
+		if (UpdateSpatialHashEntry(SpatialHashListenerCells, SpatialHashListenerLookup, ItListener->Key, Listener.CachedLocation))
+		{
+			MovedListeners.Add(ItListener->Key);
+		}
+	}
+
+	// Nothing changed cells, every pair is still within the drift padding of when it was last checked
+	if (MovedTargets.Num() == 0 && MovedListeners.Num() == 0)
+		return;
+
+	const TSet<FAISightTargetVR::FTargetId> MovedTargetSet(MovedTargets);
+	const TSet<FPerceptionListenerID> MovedListenerSet(MovedListeners);
+
+	// Drop queries that have moved well out of range, they get re-created when one side changes cell close to the other again.
+	// Only pairs with a side that changed cells can need culling or re-pairing, so only those pairs are looked at and tracked.
+	// Queries that currently see their target are kept so that the lost sight stimulus still happens.
+	TSet<uint64> MovedPairs;
+
+	auto CullQuery = [&](TArray<FAISightQueryVR>& SightQueries, const int32 QueryIndex)->EReverseForEachResult
+	{
+		const FAISightQueryVR& SightQuery = SightQueries[QueryIndex];
+
+		if (!MovedListenerSet.Contains(SightQuery.ObserverId) && !MovedTargetSet.Contains(SightQuery.TargetId))
+			return EReverseForEachResult::UnTouched;
+
+		if (!SightQuery.bLastResult)
+		{
+			const FPerceptionListener* Listener = ListenersMap.Find(SightQuery.ObserverId);
+			const FDigestedSightProperties* PropDigest = DigestedProperties.Find(SightQuery.ObserverId);
+			const FAISightTargetVR* SightTarget = ObservedTargets.Find(SightQuery.TargetId);
+
+			if (Listener && PropDigest && SightTarget && SightTarget->Target.IsValid())
+			{
+				const float CullRange = GetSpatialHashListenerRange(*PropDigest) + SightSpatialHashCellSize;
+				if (FVector::DistSquared2D(Listener->CachedLocation, SightTarget->GetLocationSimple()) > FMath::Square(CullRange))
+				{
+					SightQueries.RemoveAtSwap(QueryIndex, 1, /*bAllowShrinking=*/false);
+					return EReverseForEachResult::Modified;
+				}
+			}
+		}
+
+		MovedPairs.Add(GetSightQueryKey(SightQuery.ObserverId, SightQuery.TargetId));
+		return EReverseForEachResult::UnTouched;
+	};
+
+	if (ReverseForEach(SightQueriesInRange, CullQuery) == EReverseForEachResult::Modified)
+	{
+		bSightQueriesInRangeDirty = true;
+	}
+	if (ReverseForEach(SightQueriesOutOfRange, CullQuery) == EReverseForEachResult::Modified)
+	{
+		bSightQueriesOutOfRangeDirty = true;
+	}
+
+	// Pair up anything that moved with whatever is near it now
+	auto TryAddPair = [&](const FPerceptionListener& Listener, const FAISightTargetVR& SightTarget)
+	{
+		const AActor* TargetActor = SightTarget.GetTargetActor();
+		if (TargetActor == nullptr || TargetActor == Listener.GetBodyActor())
+			return;
+
+		const uint64 PairKey = GetSightQueryKey(Listener.GetListenerID(), SightTarget.TargetId);
+		if (MovedPairs.Contains(PairKey))
+			return;
+
+		const FDigestedSightProperties& PropDigest = DigestedProperties[Listener.GetListenerID()];
+		const FVector TargetLocation = SightTarget.GetLocationSimple();
+
+		if (FAISenseAffiliationFilter::ShouldSenseTeam(Listener.GetTeamAgent(), *TargetActor, PropDigest.AffiliationFlags) && IsInSightSpatialHashRange(Listener, PropDigest, TargetLocation))
+		{
+			AddSightQuery(Listener, PropDigest, SightTarget.TargetId, TargetLocation);
+			MovedPairs.Add(PairKey);
+		}
+	};
+
+	for (const FPerceptionListenerID& ListenerId : MovedListeners)
+	{
+		const FPerceptionListener& Listener = ListenersMap[ListenerId];
+		ForEachSpatialHashCell(Listener.CachedLocation, GetSpatialHashListenerRange(DigestedProperties[ListenerId]), [&](const FIntPoint& Cell)
+		{
+			if (const TArray<FAISightTargetVR::FTargetId>* CellTargets = SpatialHashTargetCells.Find(Cell))
+			{
+				for (const FAISightTargetVR::FTargetId& TargetId : *CellTargets)
+				{
+					if (const FAISightTargetVR* SightTarget = ObservedTargets.Find(TargetId))
+					{
+						TryAddPair(Listener, *SightTarget);
+					}
+				}
+			}
+		});
+	}
+
+	for (const FAISightTargetVR::FTargetId& TargetId : MovedTargets)
+	{
+		const FAISightTargetVR& SightTarget = ObservedTargets[TargetId];
+		ForEachSpatialHashCell(SightTarget.GetLocationSimple(), MaxSpatialHashListenerRange, [&](const FIntPoint& Cell)
+		{
+			if (const TArray<FPerceptionListenerID>* CellListeners = SpatialHashListenerCells.Find(Cell))
+			{
+				for (const FPerceptionListenerID& ListenerId : *CellListeners)
+				{
+					if (const FPerceptionListener* Listener = ListenersMap.Find(ListenerId))
+					{
+						if (Listener->HasSense(GetSenseID()))
+						{
+							TryAddPair(*Listener, SightTarget);
+						}
+					}
+				}
+			}
+		});
+	}
+}
+
 void UAISense_Sight_VR::OnListenerUpdateImpl(const FPerceptionListener& UpdatedListener)
 {
 	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight_ListenerUpdate);
@@ -763,6 +1386,7 @@ void UAISense_Sight_VR::OnListenerUpdateImpl(const FPerceptionListener& UpdatedL
 		// remove all queries
 		RemoveAllQueriesByListener(UpdatedListener);
 		DigestedProperties.Remove(ListenerID);
+		RemoveSpatialHashEntry(SpatialHashListenerCells, SpatialHashListenerLookup, ListenerID);
 	}
 }
 
@@ -795,6 +1419,7 @@ void UAISense_Sight_VR::OnListenerRemovedImpl(const FPerceptionListener& Removed
 	RemoveAllQueriesByListener(RemovedListener);
 
 	DigestedProperties.FindAndRemoveChecked(RemovedListener.GetListenerID());
+	RemoveSpatialHashEntry(SpatialHashListenerCells, SpatialHashListenerLookup, RemovedListener.GetListenerID());
 
 	// note: there use to be code to remove all queries _to_ listener here as well
 	// but that was wrong - the fact that a listener gets unregistered doesn't have to
@@ -834,10 +1459,12 @@ void UAISense_Sight_VR::RemoveAllQueriesByListener(const FPerceptionListener& Li
 
 		return EReverseForEachResult::UnTouched;
 	};
-	ReverseForEach(SightQueriesInRange, RemoveQuery);
+	if (ReverseForEach(SightQueriesInRange, RemoveQuery) == EReverseForEachResult::Modified)
+	{
+		bSightQueriesInRangeDirty = true;
+	}
 	if (ReverseForEach(SightQueriesOutOfRange, RemoveQuery) == EReverseForEachResult::Modified)
 	{
-
 		bSightQueriesOutOfRangeDirty = true;
 	}
 }
@@ -863,10 +1490,12 @@ void UAISense_Sight_VR::RemoveAllQueriesToTarget(const FAISightTargetVR::FTarget
 
 		return EReverseForEachResult::UnTouched;
 	};
-	ReverseForEach(SightQueriesInRange, RemoveQuery);
+	if (ReverseForEach(SightQueriesInRange, RemoveQuery) == EReverseForEachResult::Modified)
+	{
+		bSightQueriesInRangeDirty = true;
+	}
 	if (ReverseForEach(SightQueriesOutOfRange, RemoveQuery) == EReverseForEachResult::Modified)
 	{
-
 		bSightQueriesOutOfRangeDirty = true;
 	}
 }
@@ -874,23 +1503,10 @@ void UAISense_Sight_VR::RemoveAllQueriesToTarget(const FAISightTargetVR::FTarget
 
 void UAISense_Sight_VR::OnListenerForgetsActor(const FPerceptionListener& Listener, AActor& ActorToForget)
 {
-	const uint32 ListenerId = Listener.GetListenerID();
-	const uint32 TargetId = ActorToForget.GetUniqueID();
-
-	auto ForgetPreviousResult = [&ListenerId, &TargetId](FAISightQueryVR& SightQuery)->EForEachResult
-	{
-		if (SightQuery.ObserverId == ListenerId && SightQuery.TargetId == TargetId)
-		{
-			// assuming one query per observer-target pair
-			SightQuery.ForgetPreviousResult();
-			return EForEachResult::Break;
-		}
-		return EForEachResult::Continue;
-	};
-
-	if (ForEach(SightQueriesInRange, ForgetPreviousResult) == EForEachResult::Continue)
+	// assuming one query per observer-target pair
+	if (FAISightQueryVR* SightQuery = FindSightQuery(Listener.GetListenerID(), ActorToForget.GetUniqueID()))
 	{
-		ForEach(SightQueriesOutOfRange, ForgetPreviousResult);
+		SightQuery->ForgetPreviousResult();
 	}
 }
 
@@ -0,0 +1,345 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/VRCharacterSignificanceSubsystem.h"
+#include "VRBaseCharacter.h"
+#include "VRBaseCharacterMovementComponent.h"
+#include "ReplicatedVRCameraComponent.h"
+#include "ParentRelativeAttachmentComponent.h"
+#include "GripMotionControllerComponent.h"
+#include "VRGlobalSettings.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("VRCharacterSignificance Update"), STAT_VRCharacterSignificanceUpdate, STATGROUP_VRCharacterSignificance);
+DECLARE_DWORD_COUNTER_STAT(TEXT("VRCharacterSignificance Scaled Characters"), STAT_VRCharacterSignificanceScaled, STATGROUP_VRCharacterSignificance);
+
+	void FVRCharacterSignificanceEntry::StoreDefaults()
+	{
+		AVRBaseCharacter* OwningCharacter = Character.Get();
+		if (!OwningCharacter)
+			return;
+
+		if (UVRBaseCharacterMovementComponent* MoveComp = OwningCharacter->VRMovementReference)
+		{
+			MovementTickInterval = MoveComp->GetComponentTickInterval();
+		}
+
+		if (UReplicatedVRCameraComponent* Camera = OwningCharacter->VRReplicatedCamera)
+		{
+			CameraTickInterval = Camera->GetComponentTickInterval();
+			bCameraSmoothReplicatedMotion = Camera->bSmoothReplicatedMotion;
+		}
+
+		if (UGripMotionControllerComponent* LeftController = OwningCharacter->LeftMotionController)
+		{
+			LeftControllerTickInterval = LeftController->GetComponentTickInterval();
+			bLeftSmoothReplicatedMotion = LeftController->bSmoothReplicatedMotion;
+			bLeftDisableLowLatencyUpdate = LeftController->bDisableLowLatencyUpdate;
+		}
+
+		if (UGripMotionControllerComponent* RightController = OwningCharacter->RightMotionController)
+		{
+			RightControllerTickInterval = RightController->GetComponentTickInterval();
+			bRightSmoothReplicatedMotion = RightController->bSmoothReplicatedMotion;
+			bRightDisableLowLatencyUpdate = RightController->bDisableLowLatencyUpdate;
+		}
+
+		if (UParentRelativeAttachmentComponent* ParentRelative = OwningCharacter->ParentRelativeAttachment)
+		{
+			ParentRelativeTickInterval = ParentRelative->GetComponentTickInterval();
+			bParentRelativeIgnoreRotation = ParentRelative->bIgnoreRotationFromParent;
+		}
+
+		bHasStoredDefaults = true;
+	}
+
+	void FVRCharacterSignificanceEntry::RestoreDefaults()
+	{
+		AVRBaseCharacter* OwningCharacter = Character.Get();
+		if (!OwningCharacter || !bHasStoredDefaults)
+		{
+			AppliedTier = INDEX_NONE;
+			DistanceTier = INDEX_NONE;
+			return;
+		}
+
+		if (UVRBaseCharacterMovementComponent* MoveComp = OwningCharacter->VRMovementReference)
+		{
+			MoveComp->SetComponentTickInterval(MovementTickInterval);
+		}
+
+		if (UReplicatedVRCameraComponent* Camera = OwningCharacter->VRReplicatedCamera)
+		{
+			Camera->SetComponentTickInterval(CameraTickInterval);
+			Camera->bSmoothReplicatedMotion = bCameraSmoothReplicatedMotion;
+		}
+
+		if (UGripMotionControllerComponent* LeftController = OwningCharacter->LeftMotionController)
+		{
+			LeftController->SetComponentTickInterval(LeftControllerTickInterval);
+			LeftController->bSmoothReplicatedMotion = bLeftSmoothReplicatedMotion;
+			LeftController->bDisableLowLatencyUpdate = bLeftDisableLowLatencyUpdate;
+		}
+
+		if (UGripMotionControllerComponent* RightController = OwningCharacter->RightMotionController)
+		{
+			RightController->SetComponentTickInterval(RightControllerTickInterval);
+			RightController->bSmoothReplicatedMotion = bRightSmoothReplicatedMotion;
+			RightController->bDisableLowLatencyUpdate = bRightDisableLowLatencyUpdate;
+		}
+
+		if (UParentRelativeAttachmentComponent* ParentRelative = OwningCharacter->ParentRelativeAttachment)
+		{
+			ParentRelative->SetComponentTickInterval(ParentRelativeTickInterval);
+			ParentRelative->bIgnoreRotationFromParent = bParentRelativeIgnoreRotation;
+		}
+
+		AppliedTier = INDEX_NONE;
+		DistanceTier = INDEX_NONE;
+	}
+
+	void FVRCharacterSignificanceEntry::ApplyTier(const FBPVRCharacterSignificanceTier& Tier)
+	{
+		AVRBaseCharacter* OwningCharacter = Character.Get();
+		if (!OwningCharacter)
+			return;
+
+		if (!bHasStoredDefaults)
+		{
+			StoreDefaults();
+		}
+
+		// Tick intervals never go below what the character was originally set to
+		if (UVRBaseCharacterMovementComponent* MoveComp = OwningCharacter->VRMovementReference)
+		{
+			MoveComp->SetComponentTickInterval(FMath::Max(Tier.TickInterval, MovementTickInterval));
+		}
+
+		if (UReplicatedVRCameraComponent* Camera = OwningCharacter->VRReplicatedCamera)
+		{
+			Camera->SetComponentTickInterval(FMath::Max(Tier.TickInterval, CameraTickInterval));
+			Camera->bSmoothReplicatedMotion = bCameraSmoothReplicatedMotion && !Tier.bDisableCameraSmoothing;
+		}
+
+		if (UGripMotionControllerComponent* LeftController = OwningCharacter->LeftMotionController)
+		{
+			LeftController->SetComponentTickInterval(FMath::Max(Tier.TickInterval, LeftControllerTickInterval));
+			LeftController->bSmoothReplicatedMotion = bLeftSmoothReplicatedMotion && !Tier.bDisableHandSmoothing;
+			LeftController->bDisableLowLatencyUpdate = bLeftDisableLowLatencyUpdate || Tier.bDisableLateUpdates;
+		}
+
+		if (UGripMotionControllerComponent* RightController = OwningCharacter->RightMotionController)
+		{
+			RightController->SetComponentTickInterval(FMath::Max(Tier.TickInterval, RightControllerTickInterval));
+			RightController->bSmoothReplicatedMotion = bRightSmoothReplicatedMotion && !Tier.bDisableHandSmoothing;
+			RightController->bDisableLowLatencyUpdate = bRightDisableLowLatencyUpdate || Tier.bDisableLateUpdates;
+		}
+
+		if (UParentRelativeAttachmentComponent* ParentRelative = OwningCharacter->ParentRelativeAttachment)
+		{
+			ParentRelative->SetComponentTickInterval(FMath::Max(Tier.TickInterval, ParentRelativeTickInterval));
+			ParentRelative->bIgnoreRotationFromParent = bParentRelativeIgnoreRotation || Tier.bDisableParentRelativeYaw;
+		}
+	}
+
+	void UVRCharacterSignificanceSubsystem::RegisterCharacter(AVRBaseCharacter* InCharacter)
+	{
+		if (!InCharacter)
+			return;
+
+		for (const FVRCharacterSignificanceEntry& Entry : Characters)
+		{
+			if (Entry.Character.Get() == InCharacter)
+				return;
+		}
+
+		Characters.Emplace(InCharacter);
+
+		// Get new characters scaled right away instead of waiting out the interval
+		ForceSignificanceUpdate();
+	}
+
+	void UVRCharacterSignificanceSubsystem::UnregisterCharacter(AVRBaseCharacter* InCharacter)
+	{
+		for (int32 i = Characters.Num() - 1; i >= 0; --i)
+		{
+			if (Characters[i].Character.Get() == InCharacter)
+			{
+				Characters[i].RestoreDefaults();
+				Characters.RemoveAtSwap(i, 1, false);
+				return;
+			}
+		}
+	}
+
+	int32 UVRCharacterSignificanceSubsystem::GetCharacterSignificanceTier(AVRBaseCharacter* InCharacter) const
+	{
+		for (const FVRCharacterSignificanceEntry& Entry : Characters)
+		{
+			if (Entry.Character.Get() == InCharacter)
+				return Entry.AppliedTier;
+		}
+
+		return INDEX_NONE;
+	}
+
+	void UVRCharacterSignificanceSubsystem::ForceSignificanceUpdate()
+	{
+		TimeSinceLastUpdate = FLT_MAX;
+	}
+
+	void UVRCharacterSignificanceSubsystem::Deinitialize()
+	{
+		for (FVRCharacterSignificanceEntry& Entry : Characters)
+		{
+			Entry.RestoreDefaults();
+		}
+
+		Characters.Empty();
+		Super::Deinitialize();
+	}
+
+	void UVRCharacterSignificanceSubsystem::UpdateSignificance()
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VRCharacterSignificanceUpdate);
+
+		const UVRGlobalSettings* VRSettings = GetDefault<UVRGlobalSettings>();
+		const TArray<FBPVRCharacterSignificanceTier>& Tiers = VRSettings->CharacterSignificanceTiers;
+		UWorld* World = GetWorld();
+
+		if (!World || Tiers.Num() < 1)
+			return;
+
+		// Gather the local views, more than one for split screen
+		TArray<FVector, TInlineAllocator<4>> ViewLocations;
+		for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+		{
+			APlayerController* PC = Iterator->Get();
+			if (PC && PC->IsLocalController() && PC->PlayerCameraManager)
+			{
+				ViewLocations.Add(PC->PlayerCameraManager->GetCameraLocation());
+			}
+		}
+
+		// Dedicated servers and the like, nothing to scale against
+		if (ViewLocations.Num() < 1)
+			return;
+
+		const float Hysteresis = 1.0f + VRSettings->CharacterSignificanceHysteresis;
+		const int32 LastTier = Tiers.Num() - 1;
+		int32 NumScaled = 0;
+
+		for (int32 i = Characters.Num() - 1; i >= 0; --i)
+		{
+			FVRCharacterSignificanceEntry& Entry = Characters[i];
+			AVRBaseCharacter* OwningCharacter = Entry.Character.Get();
+
+			if (!OwningCharacter)
+			{
+				Characters.RemoveAtSwap(i, 1, false);
+				continue;
+			}
+
+			// Only remote characters are scaled, if we took over the character then put it back to how it was
+			if (OwningCharacter->GetLocalRole() != ROLE_SimulatedProxy)
+			{
+				if (Entry.AppliedTier != INDEX_NONE)
+				{
+					Entry.RestoreDefaults();
+				}
+				continue;
+			}
+
+			const FVector CharacterLocation = OwningCharacter->GetActorLocation();
+			float ClosestDistSq = FLT_MAX;
+			for (const FVector& ViewLocation : ViewLocations)
+			{
+				ClosestDistSq = FMath::Min(ClosestDistSq, FVector::DistSquared(ViewLocation, CharacterLocation));
+			}
+
+			const float Distance = FMath::Sqrt(ClosestDistSq);
+
+			int32 NewDistanceTier = LastTier;
+			for (int32 TierIndex = 0; TierIndex < Tiers.Num(); ++TierIndex)
+			{
+				if (Distance <= Tiers[TierIndex].MaxDistance)
+				{
+					NewDistanceTier = TierIndex;
+					break;
+				}
+			}
+
+			// Moving away from the view has to clear the current tiers range by the hysteresis amount before dropping,
+			// moving closer is taken right away.
+			if (Entry.DistanceTier != INDEX_NONE && NewDistanceTier > Entry.DistanceTier &&
+				Distance <= Tiers[Entry.DistanceTier].MaxDistance * Hysteresis)
+			{
+				NewDistanceTier = Entry.DistanceTier;
+			}
+
+			Entry.DistanceTier = NewDistanceTier;
+
+			int32 NewTier = NewDistanceTier;
+			if (VRSettings->bDemoteOffScreenCharacters && !OwningCharacter->WasRecentlyRendered(0.2f))
+			{
+				NewTier = FMath::Min(NewTier + 1, LastTier);
+			}
+
+			if (NewTier != Entry.AppliedTier)
+			{
+				Entry.ApplyTier(Tiers[NewTier]);
+				Entry.AppliedTier = NewTier;
+			}
+
+			if (NewTier > 0)
+			{
+				++NumScaled;
+			}
+		}
+
+		SET_DWORD_STAT(STAT_VRCharacterSignificanceScaled, NumScaled);
+	}
+
+	void UVRCharacterSignificanceSubsystem::Tick(float DeltaTime)
+	{
+		TimeSinceLastUpdate += DeltaTime;
+
+		if (TimeSinceLastUpdate >= GetDefault<UVRGlobalSettings>()->CharacterSignificanceUpdateInterval)
+		{
+			TimeSinceLastUpdate = 0.0f;
+			UpdateSignificance();
+		}
+	}
+
+	bool UVRCharacterSignificanceSubsystem::IsTickable() const
+	{
+		return Characters.Num() > 0;
+	}
+
+	UWorld* UVRCharacterSignificanceSubsystem::GetTickableGameObjectWorld() const
+	{
+		return GetWorld();
+	}
+
+	bool UVRCharacterSignificanceSubsystem::IsTickableInEditor() const
+	{
+		return false;
+	}
+
+	bool UVRCharacterSignificanceSubsystem::IsTickableWhenPaused() const
+	{
+		return false;
+	}
+
+	ETickableTickType UVRCharacterSignificanceSubsystem::GetTickableTickType() const
+	{
+		if (IsTemplate(RF_ClassDefaultObject))
+			return ETickableTickType::Never;
+
+		return ETickableTickType::Conditional;
+	}
+
+	TStatId UVRCharacterSignificanceSubsystem::GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(UVRCharacterSignificanceSubsystem, STATGROUP_Tickables);
+	}
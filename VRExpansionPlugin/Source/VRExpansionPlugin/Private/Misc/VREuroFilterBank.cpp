@@ -0,0 +1,125 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VREuroFilterBank.h"
+
+DEFINE_STAT(STAT_VREuroFilterBankFilters);
+DECLARE_CYCLE_STAT(TEXT("VREuroFilterBank RunFilters"), STAT_VREuroFilterBankRun, STATGROUP_VRFilters);
+
+FVREuroFilterHandle FVREuroLowPassFilterBank::RegisterFilter(const FBPEuroLowPassFilter& Settings)
+{
+	FVREuroFilterHandle NewHandle;
+
+	if (FreeSlots.Num() > 0)
+	{
+		NewHandle.Index = FreeSlots.Pop(false);
+	}
+	else
+	{
+		NewHandle.Index = NumSlots++;
+
+		// Grow a full register of lanes at a time so the pass never needs a scalar tail
+		if (NewHandle.Index >= MinCutoff.Num())
+		{
+			const int32 NewLanes = MinCutoff.Num() + 4;
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				Input[Axis].SetNumZeroed(NewLanes);
+				RawPrevious[Axis].SetNumZeroed(NewLanes);
+				DeltaPrevious[Axis].SetNumZeroed(NewLanes);
+			}
+
+			MinCutoff.SetNumZeroed(NewLanes);
+			CutoffSlope.SetNumZeroed(NewLanes);
+			DeltaCutoff.SetNumZeroed(NewLanes);
+			FirstTime.SetNumZeroed(NewLanes);
+		}
+	}
+
+	SetFilterSettings(NewHandle, Settings);
+	SetFilterInput(NewHandle, FVector::ZeroVector);
+	ResetFilter(NewHandle);
+	return NewHandle;
+}
+
+void FVREuroLowPassFilterBank::UnregisterFilter(FVREuroFilterHandle& Handle)
+{
+	if (!IsValidHandle(Handle))
+		return;
+
+	FreeSlots.Add(Handle.Index);
+	Handle.Index = INDEX_NONE;
+}
+
+void FVREuroLowPassFilterBank::SetFilterSettings(const FVREuroFilterHandle& Handle, const FBPEuroLowPassFilter& Settings)
+{
+	if (!IsValidHandle(Handle))
+		return;
+
+	MinCutoff[Handle.Index] = Settings.MinCutoff;
+	CutoffSlope[Handle.Index] = Settings.CutoffSlope;
+	DeltaCutoff[Handle.Index] = Settings.DeltaCutoff;
+}
+
+void FVREuroLowPassFilterBank::ResetFilter(const FVREuroFilterHandle& Handle)
+{
+	if (!IsValidHandle(Handle))
+		return;
+
+	FirstTime[Handle.Index] = 1.0f;
+}
+
+void FVREuroLowPassFilterBank::SetFilterInput(const FVREuroFilterHandle& Handle, const FVector& InRawValue)
+{
+	if (!IsValidHandle(Handle))
+		return;
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		Input[Axis][Handle.Index] = InRawValue[Axis];
+	}
+}
+
+FVector FVREuroLowPassFilterBank::GetFilterOutput(const FVREuroFilterHandle& Handle) const
+{
+	if (!IsValidHandle(Handle))
+		return FVector::ZeroVector;
+
+	if (FirstTime[Handle.Index] > 0.0f)
+		return FVector(Input[0][Handle.Index], Input[1][Handle.Index], Input[2][Handle.Index]);
+
+	return FVector(RawPrevious[0][Handle.Index], RawPrevious[1][Handle.Index], RawPrevious[2][Handle.Index]);
+}
+
+void FVREuroLowPassFilterBank::RunFilters(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VREuroFilterBankRun);
+	INC_DWORD_STAT_BY(STAT_VREuroFilterBankFilters, GetNumFilters());
+
+	const VectorRegister DeltaTimeReg = VectorSetFloat1(DeltaTime);
+	const VectorRegister Zero = VectorZero();
+	const int32 NumLanes = MinCutoff.Num();
+
+	// Free slots are run along with the rest, it is cheaper than branching per lane
+	for (int32 Lane = 0; Lane < NumLanes; Lane += 4)
+	{
+		const VectorRegister MinCutoffReg = VectorLoadAligned(&MinCutoff[Lane]);
+		const VectorRegister CutoffSlopeReg = VectorLoadAligned(&CutoffSlope[Lane]);
+		const VectorRegister DeltaCutoffReg = VectorLoadAligned(&DeltaCutoff[Lane]);
+		const VectorRegister FirstMask = VectorCompareGT(VectorLoadAligned(&FirstTime[Lane]), Zero);
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const VectorRegister Raw = VectorLoadAligned(&Input[Axis][Lane]);
+			VectorRegister RawPrev = VectorLoadAligned(&RawPrevious[Axis][Lane]);
+			VectorRegister DeltaPrev = VectorLoadAligned(&DeltaPrevious[Axis][Lane]);
+
+			VREuroFilter::FilterStep(Raw, RawPrev, DeltaPrev, MinCutoffReg, CutoffSlopeReg, DeltaCutoffReg, DeltaTimeReg);
+
+			// First samples pass through with no delta
+			VectorStoreAligned(VectorSelect(FirstMask, Raw, RawPrev), &RawPrevious[Axis][Lane]);
+			VectorStoreAligned(VectorSelect(FirstMask, Zero, DeltaPrev), &DeltaPrevious[Axis][Lane]);
+		}
+
+		VectorStoreAligned(Zero, &FirstTime[Lane]);
+	}
+}
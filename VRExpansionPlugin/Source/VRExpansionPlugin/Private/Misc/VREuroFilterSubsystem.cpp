@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VREuroFilterSubsystem.h"
+
+	void UVREuroFilterSubsystem::Deinitialize()
+	{
+		FilterBank = FVREuroLowPassFilterBank();
+
+		Super::Deinitialize();
+	}
+
+	void UVREuroFilterSubsystem::Tick(float DeltaTime)
+	{
+		FilterBank.RunFilters(DeltaTime);
+	}
+
+	bool UVREuroFilterSubsystem::IsTickable() const
+	{
+		return FilterBank.GetNumFilters() > 0;
+	}
+
+	UWorld* UVREuroFilterSubsystem::GetTickableGameObjectWorld() const
+	{
+		return GetWorld();
+	}
+
+	bool UVREuroFilterSubsystem::IsTickableInEditor() const
+	{
+		return false;
+	}
+
+	bool UVREuroFilterSubsystem::IsTickableWhenPaused() const
+	{
+		return false;
+	}
+
+	ETickableTickType UVREuroFilterSubsystem::GetTickableTickType() const
+	{
+		if (IsTemplate(RF_ClassDefaultObject))
+			return ETickableTickType::Never;
+
+		return ETickableTickType::Conditional;
+	}
+
+	TStatId UVREuroFilterSubsystem::GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(UVREuroFilterSubsystem, STATGROUP_Tickables);
+	}
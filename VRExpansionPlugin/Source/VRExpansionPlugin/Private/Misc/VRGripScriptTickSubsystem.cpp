@@ -0,0 +1,177 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRGripScriptTickSubsystem.h"
+#include "GripScripts/VRGripScriptBase.h"
+
+DECLARE_CYCLE_STAT(TEXT("VRGripScripts Tick"), STAT_VRGripScriptsTick, STATGROUP_VRGripScripts);
+DEFINE_STAT(STAT_VRGripScriptsTicking);
+
+	FVRGripScriptTickBucket& UVRGripScriptTickSubsystem::FindOrAddBucket(UClass* ScriptClass)
+	{
+		if (int32* Index = BucketIndices.Find(ScriptClass))
+		{
+			return Buckets[*Index];
+		}
+
+		FVRGripScriptTickBucket& NewBucket = Buckets.AddDefaulted_GetRef();
+		NewBucket.ScriptClass = ScriptClass;
+
+#if STATS
+		NewBucket.StatId = FDynamicStats::CreateStatId<FStatGroup_STATGROUP_VRGripScripts>(ScriptClass->GetFName());
+#endif
+
+		BucketIndices.Add(ScriptClass, Buckets.Num() - 1);
+		return NewBucket;
+	}
+
+	void UVRGripScriptTickSubsystem::RegisterScript(UVRGripScriptBase* Script)
+	{
+		if (!Script)
+			return;
+
+		FVRGripScriptTickBucket& Bucket = FindOrAddBucket(Script->GetClass());
+		const int32 EntryIndex = Bucket.FindScript(Script);
+
+		if (EntryIndex != INDEX_NONE)
+		{
+			// Still in its bucket, it just hadn't been cleaned up yet
+			Bucket.Scripts[EntryIndex].bPendingRemoval = false;
+		}
+		else
+		{
+			Bucket.Scripts.Emplace(Script);
+			++NumTickingScripts;
+		}
+	}
+
+	void UVRGripScriptTickSubsystem::UnregisterScript(UVRGripScriptBase* Script)
+	{
+		if (!Script)
+			return;
+
+		if (int32* Index = BucketIndices.Find(Script->GetClass()))
+		{
+			FVRGripScriptTickBucket& Bucket = Buckets[*Index];
+			const int32 EntryIndex = Bucket.FindScript(Script);
+
+			if (EntryIndex == INDEX_NONE)
+				return;
+
+			if (bIsTicking)
+			{
+				// Can't shuffle the bucket under the tick loop, flag it and clean up after
+				Bucket.Scripts[EntryIndex].bPendingRemoval = true;
+				bHasPendingRemovals = true;
+			}
+			else
+			{
+				Bucket.Scripts.RemoveAtSwap(EntryIndex, 1, false);
+				--NumTickingScripts;
+			}
+		}
+	}
+
+	void UVRGripScriptTickSubsystem::Deinitialize()
+	{
+		// Scripts outliving us must register again with whatever subsystem comes next
+		for (FVRGripScriptTickBucket& Bucket : Buckets)
+		{
+			for (const FVRGripScriptTickEntry& Entry : Bucket.Scripts)
+			{
+				if (UVRGripScriptBase* Script = Entry.Script.Get())
+				{
+					Script->bIsRegisteredForTick = false;
+				}
+			}
+		}
+
+		Buckets.Empty();
+		BucketIndices.Empty();
+		bHasPendingRemovals = false;
+		NumTickingScripts = 0;
+
+		Super::Deinitialize();
+	}
+
+	void UVRGripScriptTickSubsystem::Tick(float DeltaTime)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VRGripScriptsTick);
+
+		bIsTicking = true;
+
+		// Indexed loops, scripts can start other scripts ticking from their own tick
+		for (int32 BucketIndex = 0; BucketIndex < Buckets.Num(); ++BucketIndex)
+		{
+			if (Buckets[BucketIndex].Scripts.Num() < 1)
+				continue;
+
+			FScopeCycleCounter BucketCycleCounter(Buckets[BucketIndex].StatId);
+
+			for (int32 ScriptIndex = 0; ScriptIndex < Buckets[BucketIndex].Scripts.Num(); ++ScriptIndex)
+			{
+				const FVRGripScriptTickEntry& Entry = Buckets[BucketIndex].Scripts[ScriptIndex];
+				UVRGripScriptBase* Script = Entry.Script.Get();
+
+				if (!Script || Entry.bPendingRemoval)
+					continue;
+
+				if (!Script->IsTickable())
+				{
+					// Ticking was turned off without going through SetTickEnabled
+					Script->UpdateTickRegistration();
+					continue;
+				}
+
+				Script->Tick(DeltaTime);
+			}
+		}
+
+		bIsTicking = false;
+
+		// Clear out anything that stopped ticking or was garbage collected while ticking
+		const bool bRemoveFlagged = bHasPendingRemovals;
+		bHasPendingRemovals = false;
+
+		for (FVRGripScriptTickBucket& Bucket : Buckets)
+		{
+			NumTickingScripts -= Bucket.Scripts.RemoveAllSwap([bRemoveFlagged](const FVRGripScriptTickEntry& Entry)
+			{
+				return (bRemoveFlagged && Entry.bPendingRemoval) || !Entry.Script.IsValid();
+			}, false);
+		}
+
+		SET_DWORD_STAT(STAT_VRGripScriptsTicking, NumTickingScripts);
+	}
+
+	bool UVRGripScriptTickSubsystem::IsTickable() const
+	{
+		return NumTickingScripts > 0;
+	}
+
+	UWorld* UVRGripScriptTickSubsystem::GetTickableGameObjectWorld() const
+	{
+		return GetWorld();
+	}
+
+	bool UVRGripScriptTickSubsystem::IsTickableInEditor() const
+	{
+		return false;
+	}
+
+	bool UVRGripScriptTickSubsystem::IsTickableWhenPaused() const
+	{
+		return false;
+	}
+
+	ETickableTickType UVRGripScriptTickSubsystem::GetTickableTickType() const
+	{
+		if (IsTemplate(RF_ClassDefaultObject))
+			return ETickableTickType::Never;
+
+		return ETickableTickType::Conditional;
+	}
+
+	TStatId UVRGripScriptTickSubsystem::GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(UVRGripScriptTickSubsystem, STATGROUP_Tickables);
+	}
@@ -0,0 +1,71 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/VRInteractibleUpdateSubsystem.h"
+#include "Interactibles/VRLeverComponent.h"
+#include "Interactibles/VRDialComponent.h"
+#include "Interactibles/VRSliderComponent.h"
+#include "Interactibles/VRButtonComponent.h"
+#include "VRGlobalSettings.h"
+
+DECLARE_CYCLE_STAT(TEXT("VRInteractibles Batched Update"), STAT_VRInteractiblesUpdate, STATGROUP_VRInteractibles);
+DEFINE_STAT(STAT_VRInteractiblesActive);
+
+	bool UVRInteractibleUpdateSubsystem::ShouldBatchUpdates()
+	{
+		return GetDefault<UVRGlobalSettings>()->bUseBatchedInteractibleUpdates;
+	}
+
+	void UVRInteractibleUpdateSubsystem::Deinitialize()
+	{
+		Levers.Active.Empty();
+		Dials.Active.Empty();
+		Sliders.Active.Empty();
+		Buttons.Active.Empty();
+
+		Super::Deinitialize();
+	}
+
+	void UVRInteractibleUpdateSubsystem::Tick(float DeltaTime)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VRInteractiblesUpdate);
+
+		Levers.Update(DeltaTime);
+		Dials.Update(DeltaTime);
+		Sliders.Update(DeltaTime);
+		Buttons.Update(DeltaTime);
+
+		SET_DWORD_STAT(STAT_VRInteractiblesActive, Levers.Active.Num() + Dials.Active.Num() + Sliders.Active.Num() + Buttons.Active.Num());
+	}
+
+	bool UVRInteractibleUpdateSubsystem::IsTickable() const
+	{
+		return Levers.Active.Num() > 0 || Dials.Active.Num() > 0 || Sliders.Active.Num() > 0 || Buttons.Active.Num() > 0;
+	}
+
+	UWorld* UVRInteractibleUpdateSubsystem::GetTickableGameObjectWorld() const
+	{
+		return GetWorld();
+	}
+
+	bool UVRInteractibleUpdateSubsystem::IsTickableInEditor() const
+	{
+		return false;
+	}
+
+	bool UVRInteractibleUpdateSubsystem::IsTickableWhenPaused() const
+	{
+		return false;
+	}
+
+	ETickableTickType UVRInteractibleUpdateSubsystem::GetTickableTickType() const
+	{
+		if (IsTemplate(RF_ClassDefaultObject))
+			return ETickableTickType::Never;
+
+		return ETickableTickType::Conditional;
+	}
+
+	TStatId UVRInteractibleUpdateSubsystem::GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(UVRInteractibleUpdateSubsystem, STATGROUP_Tickables);
+	}
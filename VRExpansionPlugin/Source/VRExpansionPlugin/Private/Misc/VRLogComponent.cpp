@@ -13,6 +13,8 @@ UVRLogComponent::UVRLogComponent(const FObjectInitializer& ObjectInitializer)
 	PrimaryComponentTick.bCanEverTick = false;
 	MaxLineLength = 130;
 	MaxStoredMessages = 10000;
+	LastOutputLogNewestLine = -1;
+	LastOutputLogScrollPos = 0;
 }
 
 //=============================================================================
@@ -70,6 +72,24 @@ bool UVRLogComponent::DrawConsoleToRenderTarget2D(EBPVRConsoleDrawType DrawType,
 	{
 		return false;
 	}
+
+	if (!bForceDraw && DrawType == EBPVRConsoleDrawType::VRConsole_Draw_OutputLogOnly && Texture == LastOutputLogTexture.Get())
+	{
+		// Skip the draw entirely if the visible window is the same as what is already in the render target (unless forced, the target may have been cleared)
+		const int32 NumLines = OutputLogHistory.GetNumLines();
+		int32 ScrollPos = 0;
+		if (ScrollOffset > 0 && NumLines > 1)
+			ScrollPos = FMath::Clamp(FMath::RoundToInt(NumLines * ScrollOffset), 0, NumLines - 1);
+
+		if (OutputLogHistory.GetNewestLineIndex() == LastOutputLogNewestLine && ScrollPos == LastOutputLogScrollPos)
+		{
+			OutputLogHistory.bIsDirty = false;
+			return false;
+		}
+	}
+
+	if (!Texture)
+		return false;
 	//LastRenderedOutputLogSize 
 
 //	check(WorldContextObject);
@@ -101,8 +121,8 @@ bool UVRLogComponent::DrawConsoleToRenderTarget2D(EBPVRConsoleDrawType DrawType,
 	switch (DrawType)
 	{
 	//case EBPVRConsoleDrawType::VRConsole_Draw_ConsoleAndOutputLog: DrawConsole(true, Canvas); DrawOutputLog(true, Canvas); break;
-	case EBPVRConsoleDrawType::VRConsole_Draw_ConsoleOnly: DrawConsole(false, Canvas); break;
-	case EBPVRConsoleDrawType::VRConsole_Draw_OutputLogOnly: DrawOutputLog(false, Canvas, ScrollOffset); break;
+	case EBPVRConsoleDrawType::VRConsole_Draw_ConsoleOnly: DrawConsole(false, Canvas); LastOutputLogTexture.Reset(); break;
+	case EBPVRConsoleDrawType::VRConsole_Draw_OutputLogOnly: DrawOutputLog(false, Canvas, ScrollOffset); LastOutputLogTexture = Texture; break;
 	default: break;
 	}
 
@@ -163,32 +183,54 @@ void UVRLogComponent::DrawOutputLog(bool bUpperHalf, UCanvas* Canvas, float Scro
 
 	FCanvasTextItem ConsoleText(FVector2D(0, 0 + Height - 5 - yl), FText::FromString(TEXT("")), Font, FColor::Emerald);
 
-	const TArray< TSharedPtr<FVRLogMessage> > LoggedMessages = OutputLogHistory.GetMessages();
+	// Read the visible window straight out of the ring buffer, only the lines that get drawn are touched
+	const int32 NumLines = OutputLogHistory.GetNumLines();
 	
 	int32 ScrollPos = 0;
 
-	if(ScrollOffset > 0 && LoggedMessages.Num() > 1)
-		ScrollPos = FMath::Clamp(FMath::RoundToInt(LoggedMessages.Num() * ScrollOffset ) , 0, LoggedMessages.Num() - 1);
+	if(ScrollOffset > 0 && NumLines > 1)
+		ScrollPos = FMath::Clamp(FMath::RoundToInt(NumLines * ScrollOffset ) , 0, NumLines - 1);
+
+	LastOutputLogNewestLine = OutputLogHistory.GetNewestLineIndex();
+	LastOutputLogScrollPos = ScrollPos;
+
+	// Lines that are still visible reuse their text from the last draw, only new lines get built
+	CachedLogLinesScratch.Reset();
 
-	float Xpos = 0.0f;
 	float Ypos = 0.0f;
-	for (int i = LoggedMessages.Num() - (1 + ScrollPos); i >= 0 && Ypos <= Height - yl; i--)//auto &Message : LoggedMessages)
+	OutputLogHistory.ForEachLineNewestFirst(ScrollPos, [&](int64 LineIndex, const TCHAR* Line, int32 LineLength, ELogVerbosity::Type Verbosity)
 	{
-		switch (LoggedMessages[i]->Verbosity)
+		if (Ypos > Height - yl)
+			return false;
+
+		FVRCachedLogLine CachedLine;
+		if (!CachedLogLines.RemoveAndCopyValue(LineIndex, CachedLine))
 		{
+			switch (Verbosity)
+			{
+
+			case ELogVerbosity::Error:
+			case ELogVerbosity::Fatal: CachedLine.Color = FLinearColor(0.7f, 0.1f, 0.1f); break;
+			case ELogVerbosity::Warning: CachedLine.Color = FLinearColor(0.5f, 0.5f, 0.0f); break;
 
-		case ELogVerbosity::Error:
-		case ELogVerbosity::Fatal: ConsoleText.SetColor(FLinearColor(0.7f,0.1f,0.1f)); break;
-		case ELogVerbosity::Warning: ConsoleText.SetColor(FLinearColor(0.5f,0.5f,0.0f)); break;
+			case ELogVerbosity::Log:
+			default: CachedLine.Color = FLinearColor(0.8f, 0.8f, 0.8f);
+			}
 
-		case ELogVerbosity::Log:
-		default: ConsoleText.SetColor(FLinearColor(0.8f,0.8f,0.8f));
+			CachedLine.Text = FText::FromString(FString(LineLength, Line));
 		}
 
 		Ypos += yl;
-		ConsoleText.Text = FText::Format(NSLOCTEXT("VRLogComponent", "ConsoleFormat", "{0}"), FText::FromString(*LoggedMessages[i]->Message));
+		ConsoleText.SetColor(CachedLine.Color);
+		ConsoleText.Text = CachedLine.Text;
 		Canvas->DrawItem(ConsoleText, 0, Height - Ypos);
-	}
+
+		CachedLogLinesScratch.Add(LineIndex, MoveTemp(CachedLine));
+		return true;
+	});
+
+	// Anything left scrolled out of view
+	Swap(CachedLogLines, CachedLogLinesScratch);
 
 	OutputLogHistory.bIsDirty = false;
 }
@@ -359,6 +359,7 @@ void UVRSimpleCharacterMovementComponent::PhysFlying(float deltaTime, int32 Iter
 void UVRSimpleCharacterMovementComponent::PhysNavWalking(float deltaTime, int32 Iterations)
 {
 	//SCOPE_CYCLE_COUNTER(STAT_CharPhysNavWalking);
+	SCOPE_CYCLE_COUNTER(STAT_VRMovementPhysNavWalking);
 
 	if (deltaTime < MIN_TICK_TIME)
 	{
@@ -508,6 +509,7 @@ void UVRSimpleCharacterMovementComponent::PhysNavWalking(float deltaTime, int32
 void UVRSimpleCharacterMovementComponent::PhysFalling(float deltaTime, int32 Iterations)
 {
 	//SCOPE_CYCLE_COUNTER(STAT_CharPhysFalling);
+	SCOPE_CYCLE_COUNTER(STAT_VRMovementPhysFalling);
 
 	if (deltaTime < MIN_TICK_TIME)
 	{
@@ -820,6 +822,7 @@ void UVRSimpleCharacterMovementComponent::PhysFalling(float deltaTime, int32 Ite
 void UVRSimpleCharacterMovementComponent::PhysWalking(float deltaTime, int32 Iterations)
 {
 //	SCOPE_CYCLE_COUNTER(STAT_CharPhysWalking);
+	SCOPE_CYCLE_COUNTER(STAT_VRMovementPhysWalking);
 
 	if (deltaTime < MIN_TICK_TIME)
 	{
@@ -1160,6 +1163,8 @@ void UVRSimpleCharacterMovementComponent::SetUpdatedComponent(USceneComponent* N
 void UVRSimpleCharacterMovementComponent::ServerMove_PerformMovement(const FCharacterNetworkMoveData& MoveData)
 {
 	QUICK_SCOPE_CYCLE_COUNTER(VRCharacterMovementServerMove_PerformMovement);
+	SCOPE_CYCLE_COUNTER(STAT_VRMovementServerMovePerform);
+	INC_DWORD_STAT(STAT_VRMovementServerMoves);
 	//SCOPE_CYCLE_COUNTER(STAT_VRCharacterMovementServerMove);
 	//CSV_SCOPED_TIMING_STAT(CharacterMovement, CharacterMovementServerMove);
 
@@ -1500,6 +1505,7 @@ void UVRSimpleCharacterMovementComponent::ReplicateMoveToServer(float DeltaTime,
 			SCOPE_CYCLE_COUNTER(STAT_CharacterMovementCallServerMoveVRSimple);
 			if (ShouldUsePackedMovementRPCs())
 			{
+				INC_DWORD_STAT(STAT_VRMovementClientMovesSent);
 				CallServerMovePacked(NewMove, ClientData->PendingMove.Get(), OldMove.Get());
 			}
 			/*else
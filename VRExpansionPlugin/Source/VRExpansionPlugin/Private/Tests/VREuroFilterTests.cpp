@@ -0,0 +1,237 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "VRBPDatatypes.h"
+#include "Misc/VREuroFilterBank.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VREuroFilterTests
+{
+	// The per axis 1 Euro filter that FBPEuroLowPassFilter ran before it was moved onto VREuroFilter::FilterStep
+	struct FScalarEuroFilter
+	{
+		FBPEuroLowPassFilter Settings;
+		FVector RawPrevious;
+		FVector DeltaPrevious;
+		bool bFirstTime;
+
+		FScalarEuroFilter(const FBPEuroLowPassFilter& InSettings) :
+			Settings(InSettings),
+			RawPrevious(FVector::ZeroVector),
+			DeltaPrevious(FVector::ZeroVector),
+			bFirstTime(true)
+		{}
+
+		static float CalculateAlpha(const float InCutoff, const float InDeltaTime)
+		{
+			const float tau = 1.0f / (2.0f * PI * InCutoff);
+			return 1.0f / (1.0f + tau / InDeltaTime);
+		}
+
+		FVector RunFilterSmoothing(const FVector& InRawValue, const float InDeltaTime)
+		{
+			if (bFirstTime)
+			{
+				RawPrevious = InRawValue;
+				DeltaPrevious = FVector::ZeroVector;
+				bFirstTime = false;
+				return InRawValue;
+			}
+
+			const float DeltaAlpha = CalculateAlpha(Settings.DeltaCutoff, InDeltaTime);
+			for (int32 i = 0; i < 3; ++i)
+			{
+				const float Delta = (InRawValue[i] - RawPrevious[i]) * InDeltaTime;
+				DeltaPrevious[i] = DeltaAlpha * Delta + (1.0f - DeltaAlpha) * DeltaPrevious[i];
+
+				const float Cutoff = Settings.MinCutoff + Settings.CutoffSlope * FMath::Abs(DeltaPrevious[i]);
+				const float Alpha = CalculateAlpha(Cutoff, InDeltaTime);
+				RawPrevious[i] = Alpha * InRawValue[i] + (1.0f - Alpha) * RawPrevious[i];
+			}
+
+			return RawPrevious;
+		}
+	};
+
+	// A jittery hand path at 90hz, seeded so that every run filters the same samples
+	static void BuildHandPath(TArray<FVector>& OutSamples, int32 NumSamples)
+	{
+		FRandomStream Stream(1337);
+		OutSamples.Reset(NumSamples);
+
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			const float Time = i / 90.0f;
+			const FVector Path(FMath::Sin(Time * 3.0f) * 30.0f, FMath::Cos(Time * 2.0f) * 20.0f, 100.0f + FMath::Sin(Time * 7.0f) * 5.0f);
+			OutSamples.Add(Path + Stream.GetUnitVector() * Stream.FRandRange(0.0f, 0.5f));
+		}
+	}
+
+	static const float SampleDeltaTime = 1.0f / 90.0f;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVREuroFilterMatchesScalarTest, "VRExpansionPlugin.EuroFilter.MatchesScalar", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVREuroFilterMatchesScalarTest::RunTest(const FString& Parameters)
+{
+	using namespace VREuroFilterTests;
+
+	TArray<FVector> Samples;
+	BuildHandPath(Samples, 900);
+
+	FBPEuroLowPassFilter VectorFilter;
+	FScalarEuroFilter ScalarFilter(VectorFilter);
+
+	for (int32 i = 0; i < Samples.Num(); ++i)
+	{
+		const FVector VectorResult = VectorFilter.RunFilterSmoothing(Samples[i], SampleDeltaTime);
+		const FVector ScalarResult = ScalarFilter.RunFilterSmoothing(Samples[i], SampleDeltaTime);
+
+		if (!VectorResult.Equals(ScalarResult, KINDA_SMALL_NUMBER * 10.0f))
+		{
+			AddError(FString::Printf(TEXT("Sample %d filtered to %s, scalar filter gave %s"), i, *VectorResult.ToString(), *ScalarResult.ToString()));
+			return false;
+		}
+	}
+
+	// A reset filter passes the next sample straight through
+	VectorFilter.ResetSmoothingFilter();
+	TestEqual(TEXT("First sample after a reset is unfiltered"), VectorFilter.RunFilterSmoothing(Samples[0], SampleDeltaTime), Samples[0]);
+
+	// Five banked filters spill into a second register, each is fed an offset copy of the path
+	const int32 NumBanked = 5;
+	FVREuroLowPassFilterBank FilterBank;
+	TArray<FVREuroFilterHandle> Handles;
+	TArray<FScalarEuroFilter> BankReferences;
+
+	for (int32 FilterIndex = 0; FilterIndex < NumBanked; ++FilterIndex)
+	{
+		const FBPEuroLowPassFilter Settings(0.5f + FilterIndex * 0.1f, 0.007f, 1.0f);
+		Handles.Add(FilterBank.RegisterFilter(Settings));
+		BankReferences.Emplace(Settings);
+	}
+
+	for (int32 i = 0; i < Samples.Num(); ++i)
+	{
+		for (int32 FilterIndex = 0; FilterIndex < NumBanked; ++FilterIndex)
+		{
+			FilterBank.SetFilterInput(Handles[FilterIndex], Samples[i] + FVector(FilterIndex * 10.0f));
+		}
+
+		FilterBank.RunFilters(SampleDeltaTime);
+
+		for (int32 FilterIndex = 0; FilterIndex < NumBanked; ++FilterIndex)
+		{
+			const FVector BankResult = FilterBank.GetFilterOutput(Handles[FilterIndex]);
+			const FVector ScalarResult = BankReferences[FilterIndex].RunFilterSmoothing(Samples[i] + FVector(FilterIndex * 10.0f), SampleDeltaTime);
+
+			if (!BankResult.Equals(ScalarResult, KINDA_SMALL_NUMBER * 10.0f))
+			{
+				AddError(FString::Printf(TEXT("Banked filter %d sample %d filtered to %s, scalar filter gave %s"), FilterIndex, i, *BankResult.ToString(), *ScalarResult.ToString()));
+				return false;
+			}
+		}
+	}
+
+	// A reset banked filter passes its input through until the next pass
+	FilterBank.ResetFilter(Handles[2]);
+	FilterBank.SetFilterInput(Handles[2], Samples[0]);
+	TestEqual(TEXT("Banked filter output after a reset is its input"), FilterBank.GetFilterOutput(Handles[2]), Samples[0]);
+
+	// Freed slots are handed back out
+	const int32 FreedIndex = Handles[1].Index;
+	FilterBank.UnregisterFilter(Handles[1]);
+	TestFalse(TEXT("Unregistered handle is cleared"), Handles[1].IsValid());
+	TestEqual(TEXT("Freed slot is reused"), FilterBank.RegisterFilter(FBPEuroLowPassFilter()).Index, FreedIndex);
+	TestEqual(TEXT("Bank filter count"), FilterBank.GetNumFilters(), NumBanked);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVREuroFilterBenchmarkTest, "VRExpansionPlugin.EuroFilter.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVREuroFilterBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace VREuroFilterTests;
+
+	// A minute of 90hz play across a scene full of smoothed grips
+	const int32 NumSamples = 90 * 60;
+	const int32 NumFilters = 64;
+
+	TArray<FVector> Samples;
+	BuildHandPath(Samples, NumSamples);
+
+	TArray<FBPEuroLowPassFilter> VectorFilters;
+	VectorFilters.SetNum(NumFilters);
+
+	TArray<FScalarEuroFilter> ScalarFilters;
+	for (int32 i = 0; i < NumFilters; ++i)
+	{
+		ScalarFilters.Emplace(VectorFilters[i]);
+	}
+
+	// Sum the results so the filters can't be optimized out
+	FVector VectorSum = FVector::ZeroVector;
+	const double VectorStart = FPlatformTime::Seconds();
+	for (const FVector& Sample : Samples)
+	{
+		for (FBPEuroLowPassFilter& Filter : VectorFilters)
+		{
+			VectorSum += Filter.RunFilterSmoothing(Sample, SampleDeltaTime);
+		}
+	}
+	const double VectorTime = FPlatformTime::Seconds() - VectorStart;
+
+	FVector ScalarSum = FVector::ZeroVector;
+	const double ScalarStart = FPlatformTime::Seconds();
+	for (const FVector& Sample : Samples)
+	{
+		for (FScalarEuroFilter& Filter : ScalarFilters)
+		{
+			ScalarSum += Filter.RunFilterSmoothing(Sample, SampleDeltaTime);
+		}
+	}
+	const double ScalarTime = FPlatformTime::Seconds() - ScalarStart;
+
+	FVREuroLowPassFilterBank FilterBank;
+	TArray<FVREuroFilterHandle> Handles;
+	for (int32 i = 0; i < NumFilters; ++i)
+	{
+		Handles.Add(FilterBank.RegisterFilter(VectorFilters[i]));
+	}
+
+	FVector BankSum = FVector::ZeroVector;
+	const double BankStart = FPlatformTime::Seconds();
+	for (const FVector& Sample : Samples)
+	{
+		for (const FVREuroFilterHandle& Handle : Handles)
+		{
+			FilterBank.SetFilterInput(Handle, Sample);
+		}
+
+		FilterBank.RunFilters(SampleDeltaTime);
+
+		for (const FVREuroFilterHandle& Handle : Handles)
+		{
+			BankSum += FilterBank.GetFilterOutput(Handle);
+		}
+	}
+	const double BankTime = FPlatformTime::Seconds() - BankStart;
+
+	const double NumSteps = (double)NumSamples * NumFilters;
+	AddInfo(FString::Printf(TEXT("FBPEuroLowPassFilter: %.2f ns per step (%.3f ms total)"), (VectorTime / NumSteps) * 1e9, VectorTime * 1000.0));
+	AddInfo(FString::Printf(TEXT("FVREuroLowPassFilterBank: %.2f ns per step (%.3f ms total)"), (BankTime / NumSteps) * 1e9, BankTime * 1000.0));
+	AddInfo(FString::Printf(TEXT("Scalar reference: %.2f ns per step (%.3f ms total)"), (ScalarTime / NumSteps) * 1e9, ScalarTime * 1000.0));
+
+	TestTrue(TEXT("Banked and scalar filters agree over the run"), BankSum.Equals(ScalarSum, NumSteps * KINDA_SMALL_NUMBER));
+
+	TestTrue(TEXT("Vector and scalar filters agree over the run"), VectorSum.Equals(ScalarSum, NumSteps * KINDA_SMALL_NUMBER));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
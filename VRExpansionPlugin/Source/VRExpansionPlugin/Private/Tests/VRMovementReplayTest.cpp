@@ -0,0 +1,340 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "HAL/PlatformTime.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "UObject/CoreNet.h"
+#include "AIController.h"
+#include "VRCharacter.h"
+#include "SimpleChar/VRSimpleCharacter.h"
+#include "ReplicatedVRCameraComponent.h"
+#include "VRBaseCharacterMovementComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VRMovementReplayTests
+{
+	static const float FrameDeltaTime = 1.0f / 90.0f;
+	static const int32 NumCharacters = 32;
+
+	// One frame of recorded locomotion input
+	struct FVRMovementTraceFrame
+	{
+		FVector2D MoveInput;
+		float SnapTurnYaw;
+		bool bJump;
+
+		// Room scale HMD offset and yaw relative to the character
+		FVector2D HMDOffset;
+		float HMDYaw;
+
+		// Teleports by this distance along the actor forward vector when non zero
+		float TeleportDistance;
+
+		// Climbing is active while non zero, the value is the vertical climb delta for the frame
+		float ClimbDelta;
+	};
+
+	// Loads a trace passed in with -VRMovementTrace=<file>, one line per 90hz frame of
+	// "Forward,Right,SnapTurnYaw,Jump[,HMDX,HMDY,HMDYaw,Teleport,Climb]", the bracketed columns default to zero
+	static bool LoadTrace(const FString& TracePath, TArray<FVRMovementTraceFrame>& OutTrace)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *TracePath))
+			return false;
+
+		for (const FString& Line : Lines)
+		{
+			TArray<FString> Values;
+			if (Line.ParseIntoArray(Values, TEXT(",")) < 4)
+				continue;
+
+			FVRMovementTraceFrame& Frame = OutTrace.AddDefaulted_GetRef();
+			Frame.MoveInput = FVector2D(FCString::Atof(*Values[0]), FCString::Atof(*Values[1]));
+			Frame.SnapTurnYaw = FCString::Atof(*Values[2]);
+			Frame.bJump = FCString::Atoi(*Values[3]) != 0;
+			Frame.HMDOffset = FVector2D(Values.IsValidIndex(4) ? FCString::Atof(*Values[4]) : 0.0f, Values.IsValidIndex(5) ? FCString::Atof(*Values[5]) : 0.0f);
+			Frame.HMDYaw = Values.IsValidIndex(6) ? FCString::Atof(*Values[6]) : 0.0f;
+			Frame.TeleportDistance = Values.IsValidIndex(7) ? FCString::Atof(*Values[7]) : 0.0f;
+			Frame.ClimbDelta = Values.IsValidIndex(8) ? FCString::Atof(*Values[8]) : 0.0f;
+		}
+
+		return OutTrace.Num() > 0;
+	}
+
+	// Ten seconds of thumbstick walking with snap turns, the odd jump and teleport, room scale head sway and a climbing section.
+	// Used when no trace is passed in.
+	static void BuildDefaultTrace(TArray<FVRMovementTraceFrame>& OutTrace)
+	{
+		const int32 NumFrames = 90 * 10;
+		OutTrace.Reset(NumFrames);
+
+		for (int32 i = 0; i < NumFrames; ++i)
+		{
+			const float Time = i * FrameDeltaTime;
+
+			FVRMovementTraceFrame& Frame = OutTrace.AddDefaulted_GetRef();
+			Frame.MoveInput = FVector2D(FMath::Cos(Time * 0.7f), FMath::Sin(Time * 1.3f) * 0.5f);
+			Frame.SnapTurnYaw = (i % 180 == 90) ? 45.0f : 0.0f;
+			Frame.bJump = (i % 270 == 135);
+			Frame.HMDOffset = FVector2D(FMath::Sin(Time * 0.9f) * 20.0f, FMath::Cos(Time * 0.6f) * 15.0f);
+			Frame.HMDYaw = FMath::Sin(Time * 0.4f) * 30.0f;
+			Frame.TeleportDistance = (i % 360 == 300) ? 200.0f : 0.0f;
+			Frame.ClimbDelta = (i >= 600 && i < 720) ? 1.0f : 0.0f;
+		}
+	}
+
+	// Fills and serializes the move the owning client would send this frame, returns its size in bits.
+	// The move actions and custom input performed this frame have to be restored onto the movement component first, the tick consumes them.
+	static int64 MeasureClientMoveBits(ACharacter* Character, UPackageMap* PackageMap, int64& OutMoveActionBits)
+	{
+		UVRBaseCharacterMovementComponent* MoveComp = Cast<UVRBaseCharacterMovementComponent>(Character->GetCharacterMovement());
+		FNetworkPredictionData_Client_Character* ClientData = MoveComp ? MoveComp->GetPredictionData_Client_Character() : nullptr;
+
+		if (!ClientData)
+			return 0;
+
+		// CreateSavedMove rather than AllocateNewMove, these scratch moves shouldn't show up in the saved move allocation stat
+		FSavedMovePtr NewMove = ClientData->CreateSavedMove();
+		NewMove->SetMoveFor(Character, FrameDeltaTime, MoveComp->GetCurrentAcceleration(), *ClientData);
+		NewMove->SetInitialPosition(Character);
+		NewMove->PostUpdate(Character, FSavedMove_Character::PostUpdate_Record);
+
+		FVRMoveActionArray& MoveActions = static_cast<FSavedMove_VRBaseCharacter*>(NewMove.Get())->ConditionalValues.MoveActionArray;
+		if (MoveActions.MoveActions.Num() > 0)
+		{
+			FNetBitWriter MoveActionWriter(PackageMap, 64);
+			bool bSuccess = true;
+			MoveActions.NetSerialize(MoveActionWriter, PackageMap, bSuccess);
+			OutMoveActionBits += MoveActionWriter.GetNumBits();
+		}
+
+		FCharacterNetworkMoveDataContainer& MoveDataContainer = MoveComp->GetNetworkMoveDataContainer();
+		MoveDataContainer.ClientFillNetworkMoveData(NewMove.Get(), nullptr, nullptr);
+
+		FNetBitWriter MoveDataWriter(PackageMap, 256);
+		MoveDataContainer.Serialize(*MoveComp, MoveDataWriter, PackageMap);
+
+		MoveComp->CustomVRInputVector = FVector::ZeroVector;
+		return MoveDataWriter.GetNumBits();
+	}
+
+	// Input consumed during the world tick that the saved move needs to see afterwards
+	struct FVRPendingMoveInput
+	{
+		FVRMoveActionArray MoveActionArray;
+		FVector CustomVRInputVector;
+	};
+}
+
+/**
+* Headless locomotion regression capture, spawns a crowd of VR characters on a floor and replays an input trace through them.
+* Reports the server side CPU time per frame and the size of the move data each client would be sending.
+* Run with -nullrhi and pass -VRMovementTrace=<file> to replay a recorded trace instead of the built in one.
+*/
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FVRMovementReplayTest, "VRExpansionPlugin.Movement.Replay", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FVRMovementReplayTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	OutBeautifiedNames.Add(TEXT("VRCharacter"));
+	OutTestCommands.Add(TEXT("VRCharacter"));
+
+	OutBeautifiedNames.Add(TEXT("VRSimpleCharacter"));
+	OutTestCommands.Add(TEXT("VRSimpleCharacter"));
+}
+
+bool FVRMovementReplayTest::RunTest(const FString& Parameters)
+{
+	using namespace VRMovementReplayTests;
+
+	TArray<FVRMovementTraceFrame> Trace;
+	FString TracePath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("VRMovementTrace="), TracePath))
+	{
+		if (!LoadTrace(TracePath, Trace))
+		{
+			AddError(FString::Printf(TEXT("Failed to load movement trace %s"), *TracePath));
+			return false;
+		}
+	}
+	else
+	{
+		BuildDefaultTrace(Trace);
+	}
+
+	UClass* CharacterClass = Parameters == TEXT("VRSimpleCharacter") ? AVRSimpleCharacter::StaticClass() : AVRCharacter::StaticClass();
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("VRMovementReplay"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	// A big flat floor so that the crowd walks instead of falling forever.
+	// Static mobility meshes can't be changed once the world has begun play, so this has to happen before BeginPlay.
+	if (UStaticMesh* FloorMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")))
+	{
+		AStaticMeshActor* Floor = World->SpawnActor<AStaticMeshActor>(FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+		Floor->GetStaticMeshComponent()->SetStaticMesh(FloorMesh);
+		Floor->SetActorScale3D(FVector(400.0f, 400.0f, 1.0f));
+
+		if (Floor->GetStaticMeshComponent()->GetStaticMesh() != FloorMesh)
+		{
+			AddError(TEXT("Failed to assign the floor mesh"));
+		}
+	}
+	else
+	{
+		AddWarning(TEXT("Couldn't load the floor mesh, characters will be falling for the whole trace"));
+	}
+
+	World->BeginPlay();
+
+	TArray<ACharacter*> Characters;
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt((float)NumCharacters));
+	for (int32 i = 0; i < NumCharacters; ++i)
+	{
+		const FVector SpawnLocation((i % GridSize) * 300.0f, (i / GridSize) * 300.0f, 150.0f);
+
+		if (ACharacter* Character = World->SpawnActor<ACharacter>(CharacterClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams))
+		{
+			// A local controller keeps move actions on the owning client path instead of having them run immediately as server authed
+			if (AAIController* Controller = World->SpawnActor<AAIController>(SpawnParams))
+			{
+				Controller->Possess(Character);
+			}
+
+			Characters.Add(Character);
+		}
+	}
+
+	if (Characters.Num() != NumCharacters)
+	{
+		AddError(FString::Printf(TEXT("Only spawned %d of %d %s"), Characters.Num(), NumCharacters, *Parameters));
+	}
+
+	UPackageMap* PackageMap = NewObject<UPackageMap>();
+
+	double TickTime = 0.0;
+	int64 MoveBits = 0;
+	int64 MoveActionBits = 0;
+	int64 NumMoves = 0;
+	bool bWasClimbing = false;
+
+	TArray<FVRPendingMoveInput> PendingInput;
+	PendingInput.SetNum(Characters.Num());
+
+	FVRMovementQueryCounters::Reset();
+
+	for (const FVRMovementTraceFrame& Frame : Trace)
+	{
+		const bool bClimbing = !FMath::IsNearlyZero(Frame.ClimbDelta);
+
+		for (int32 CharIndex = 0; CharIndex < Characters.Num(); ++CharIndex)
+		{
+			ACharacter* Character = Characters[CharIndex];
+			UVRBaseCharacterMovementComponent* VRMoveComp = Cast<UVRBaseCharacterMovementComponent>(Character->GetCharacterMovement());
+
+			if (!bClimbing)
+			{
+				Character->AddMovementInput(Character->GetActorForwardVector(), Frame.MoveInput.X);
+				Character->AddMovementInput(Character->GetActorRightVector(), Frame.MoveInput.Y);
+			}
+
+			if (Frame.bJump && !bClimbing)
+			{
+				Character->Jump();
+			}
+
+			if (AVRBaseCharacter* VRCharacter = Cast<AVRBaseCharacter>(Character))
+			{
+				if (VRCharacter->VRReplicatedCamera)
+				{
+					VRCharacter->VRReplicatedCamera->SetRelativeLocationAndRotation(FVector(Frame.HMDOffset, 0.0f), FRotator(0.0f, Frame.HMDYaw, 0.0f));
+				}
+			}
+
+			if (!VRMoveComp)
+				continue;
+
+			if (bClimbing != bWasClimbing)
+			{
+				VRMoveComp->SetClimbingMode(bClimbing);
+			}
+
+			if (bClimbing)
+			{
+				VRMoveComp->AddCustomReplicatedMovement(FVector(0.0f, 0.0f, Frame.ClimbDelta));
+			}
+
+			if (!FMath::IsNearlyZero(Frame.SnapTurnYaw))
+			{
+				VRMoveComp->PerformMoveAction_SnapTurn(Frame.SnapTurnYaw);
+			}
+
+			if (!FMath::IsNearlyZero(Frame.TeleportDistance))
+			{
+				VRMoveComp->PerformMoveAction_Teleport(Character->GetActorLocation() + Character->GetActorForwardVector() * Frame.TeleportDistance, Character->GetActorRotation());
+			}
+
+			PendingInput[CharIndex].MoveActionArray = VRMoveComp->MoveActionArray;
+			PendingInput[CharIndex].CustomVRInputVector = VRMoveComp->CustomVRInputVector;
+		}
+
+		bWasClimbing = bClimbing;
+
+		const double TickStart = FPlatformTime::Seconds();
+		World->Tick(LEVELTICK_All, FrameDeltaTime);
+		TickTime += FPlatformTime::Seconds() - TickStart;
+
+		for (int32 CharIndex = 0; CharIndex < Characters.Num(); ++CharIndex)
+		{
+			ACharacter* Character = Characters[CharIndex];
+			Character->StopJumping();
+
+			if (UVRBaseCharacterMovementComponent* VRMoveComp = Cast<UVRBaseCharacterMovementComponent>(Character->GetCharacterMovement()))
+			{
+				VRMoveComp->MoveActionArray = PendingInput[CharIndex].MoveActionArray;
+				VRMoveComp->CustomVRInputVector = PendingInput[CharIndex].CustomVRInputVector;
+			}
+
+			MoveBits += MeasureClientMoveBits(Character, PackageMap, MoveActionBits);
+			++NumMoves;
+		}
+	}
+
+	const int32 NumFrames = Trace.Num();
+	if (NumFrames > 0 && Characters.Num() > 0)
+	{
+		const double BytesPerMove = (MoveBits / 8.0) / FMath::Max<int64>(NumMoves, 1);
+
+		AddInfo(FString::Printf(TEXT("%s: %d characters, %d frames"), *Parameters, Characters.Num(), NumFrames));
+		AddInfo(FString::Printf(TEXT("CPU: %.3f ms per frame, %.2f us per character per frame"), (TickTime / NumFrames) * 1000.0, (TickTime / (NumFrames * Characters.Num())) * 1000000.0));
+
+		// Object references (movement bases) write nothing through the bare package map, a live connection adds a net guid for them
+		AddInfo(FString::Printf(TEXT("Move data: %.2f bytes per move, %.1f bytes per second per client at 90hz"), BytesPerMove, BytesPerMove * 90.0));
+		AddInfo(FString::Printf(TEXT("Move actions: %.1f bytes total, %.3f bytes per move"), MoveActionBits / 8.0, (MoveActionBits / 8.0) / FMath::Max<int64>(NumMoves, 1)));
+
+		const double CharacterFrames = (double)NumFrames * Characters.Num();
+		AddInfo(FString::Printf(TEXT("Queries: %u movement sweeps (%.2f per character per frame), %u floor traces (%.2f per character per frame)"),
+			FVRMovementQueryCounters::Sweeps, FVRMovementQueryCounters::Sweeps / CharacterFrames,
+			FVRMovementQueryCounters::FloorTraces, FVRMovementQueryCounters::FloorTraces / CharacterFrames));
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -101,41 +101,22 @@ void FBPEuroLowPassFilter::ResetSmoothingFilter()
 
 FVector FBPEuroLowPassFilter::RunFilterSmoothing(const FVector &InRawValue, const float &InDeltaTime)
 {
-	// Calculate the delta, if this is the first time then there is no delta
-	const FVector Delta = RawFilter.bFirstTime == true ? FVector::ZeroVector : (InRawValue - RawFilter.Previous) * InDeltaTime;
-
-	// Filter the delta to get the estimated
-	const FVector Estimated = DeltaFilter.Filter(Delta, FVector(CalculateAlpha(DeltaCutoff, InDeltaTime)));
-
-	// Use the estimated to calculate the cutoff
-	const FVector Cutoff = CalculateCutoff(Estimated);
-
-	// Filter passed value 
-	return RawFilter.Filter(InRawValue, CalculateAlpha(Cutoff, InDeltaTime));
-}
-
-const FVector FBPEuroLowPassFilter::CalculateCutoff(const FVector& InValue)
-{
-	FVector Result;
-	for (int i = 0; i < 3; i++)
+	// If this is the first time then there is no delta and the value passes through
+	if (RawFilter.bFirstTime || DeltaFilter.bFirstTime)
 	{
-		Result[i] = MinCutoff + CutoffSlope * FMath::Abs(InValue[i]);
+		RawFilter.Previous = InRawValue;
+		RawFilter.bFirstTime = false;
+		DeltaFilter.Previous = FVector::ZeroVector;
+		DeltaFilter.bFirstTime = false;
+		return InRawValue;
 	}
-	return Result;
-}
 
-const FVector FBPEuroLowPassFilter::CalculateAlpha(const FVector& InCutoff, const double InDeltaTime) const
-{
-	FVector Result;
-	for (int i = 0; i < 3; i++)
-	{
-		Result[i] = CalculateAlpha(InCutoff[i], InDeltaTime);
-	}
-	return Result;
-}
+	VectorRegister RawPrev = VectorLoadFloat3_W0(&RawFilter.Previous);
+	VectorRegister DeltaPrev = VectorLoadFloat3_W0(&DeltaFilter.Previous);
 
-const float FBPEuroLowPassFilter::CalculateAlpha(const float InCutoff, const double InDeltaTime) const
-{
-	const float tau = 1.0 / (2 * PI * InCutoff);
-	return 1.0 / (1.0 + tau / InDeltaTime);
+	VREuroFilter::FilterStep(VectorLoadFloat3_W0(&InRawValue), RawPrev, DeltaPrev, VectorSetFloat1(MinCutoff), VectorSetFloat1(CutoffSlope), VectorSetFloat1(DeltaCutoff), VectorSetFloat1(InDeltaTime));
+
+	VectorStoreFloat3(RawPrev, &RawFilter.Previous);
+	VectorStoreFloat3(DeltaPrev, &DeltaFilter.Previous);
+	return RawFilter.Previous;
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "VRPlayerController.h"
 #include "NavigationSystem.h"
 #include "VRPathFollowingComponent.h"
+#include "Misc/VRCharacterSignificanceSubsystem.h"
+#include "VRGlobalSettings.h"
 //#include "Runtime/Engine/Private/EnginePrivate.h"
 
 DEFINE_LOG_CATEGORY(LogBaseVRCharacter);
@@ -114,6 +116,36 @@ AVRBaseCharacter::AVRBaseCharacter(const FObjectInitializer& ObjectInitializer)
 	bFlagTeleported = false;
 }
 
+void AVRBaseCharacter::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Remote characters get their tick rates scaled by distance / visibility if enabled
+	if (GetNetMode() != NM_DedicatedServer && GetDefault<UVRGlobalSettings>()->bUseVRCharacterSignificance)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			if (UVRCharacterSignificanceSubsystem* SignificanceSubsystem = World->GetSubsystem<UVRCharacterSignificanceSubsystem>())
+			{
+				SignificanceSubsystem->RegisterCharacter(this);
+			}
+		}
+	}
+}
+
+void AVRBaseCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UVRCharacterSignificanceSubsystem* SignificanceSubsystem = World->GetSubsystem<UVRCharacterSignificanceSubsystem>())
+		{
+			SignificanceSubsystem->UnregisterCharacter(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
  void AVRBaseCharacter::PossessedBy(AController* NewController)
  {
 	 Super::PossessedBy(NewController);
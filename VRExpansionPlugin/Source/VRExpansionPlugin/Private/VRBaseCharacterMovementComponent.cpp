@@ -47,6 +47,17 @@ UVRBaseCharacterMovementComponent::UVRBaseCharacterMovementComponent(const FObje
 	SetDefaultPostClimbMovementOnStepUp = true;
 	DefaultPostClimbMovement = EVRConjoinedMovementModes::C_MOVE_Falling;
 
+	bUseClimbingBroadphase = false;
+	ClimbingBroadphaseExtent = 50.0f;
+	ClimbingBroadphaseRefreshInterval = 0.5f;
+	ClimbingBroadphaseBounds.Init();
+	ClimbingBroadphaseBuildTime = 0.0f;
+
+	bUseUnifiedVRProxySmoothing = false;
+	UnifiedSmoothingVisualThreshold = 0.1f;
+	UnifiedSmoothingReferenceSpeed = 300.0f;
+	UnifiedSmoothingMinTimeScale = 0.5f;
+
 	bIgnoreSimulatingComponentsInFloorCheck = true;
 
 	VRWallSlideScaler = 1.0f;
@@ -87,6 +98,9 @@ void UVRBaseCharacterMovementComponent::OnMovementModeChanged(EMovementMode Prev
 	// Clear out the old custom input vector, it will pollute the pool now that all modes allow it.
 	CustomVRInputVector = FVector::ZeroVector;
 
+	// Force the climbing broadphase to re-gather from the current hands next time we climb
+	ClearClimbingBroadphase();
+
 	if (PreviousMovementMode == EMovementMode::MOVE_Custom && PreviousCustomMode == (uint8)EVRCustomMovementMode::VRMOVE_Seated)
 	{
 		if (MovementMode != EMovementMode::MOVE_Custom || CustomMovementMode != (uint8)EVRCustomMovementMode::VRMOVE_Seated)
@@ -390,6 +404,8 @@ void UVRBaseCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleL
 		FCollisionShape CapsuleShape = FCollisionShape::MakeCapsule(SweepRadius, PawnHalfHeight - ShrinkHeight);
 
 		FHitResult Hit(1.f);
+		INC_DWORD_STAT(STAT_VRMovementFloorTraces);
+		++FVRMovementQueryCounters::FloorTraces;
 		bBlockingHit = FloorSweepTest(Hit, CapsuleLocation, CapsuleLocation + FVector(0.f, 0.f, -TraceDist), CollisionChannel, CapsuleShape, QueryParams, ResponseParam);
 
 		if (bBlockingHit)
@@ -408,6 +424,8 @@ void UVRBaseCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleL
 					CapsuleShape.Capsule.HalfHeight = FMath::Max(PawnHalfHeight - ShrinkHeight, CapsuleShape.Capsule.Radius);
 					Hit.Reset(1.f, false);
 
+					INC_DWORD_STAT(STAT_VRMovementFloorTraces);
+					++FVRMovementQueryCounters::FloorTraces;
 					bBlockingHit = FloorSweepTest(Hit, CapsuleLocation, CapsuleLocation + FVector(0.f, 0.f, -TraceDist), CollisionChannel, CapsuleShape, QueryParams, ResponseParam);
 				}
 			}
@@ -448,6 +466,8 @@ void UVRBaseCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleL
 		QueryParams.TraceTag = SCENE_QUERY_STAT_NAME_ONLY(FloorLineTrace);
 
 		FHitResult Hit(1.f);
+		INC_DWORD_STAT(STAT_VRMovementFloorTraces);
+		++FVRMovementQueryCounters::FloorTraces;
 		bBlockingHit = GetWorld()->LineTraceSingleByChannel(Hit, LineTraceStart, LineTraceStart + Down, CollisionChannel, QueryParams, ResponseParam);
 
 		if (bBlockingHit)
@@ -656,6 +676,11 @@ bool UVRBaseCharacterMovementComponent::CheckForMoveAction()
 {
 	for (FVRMoveActionContainer& MoveAction : MoveActionArray.MoveActions)
 	{
+		if (MoveAction.MoveAction != EVRMoveAction::VRMOVEACTION_None)
+		{
+			INC_DWORD_STAT(STAT_VRMovementMoveActions);
+		}
+
 		switch (MoveAction.MoveAction)
 		{
 		case EVRMoveAction::VRMOVEACTION_SnapTurn:
@@ -834,6 +859,8 @@ bool UVRBaseCharacterMovementComponent::VRClimbStepUp(const FVector& GravDir, co
 
 void UVRBaseCharacterMovementComponent::PhysCustom_Climbing(float deltaTime, int32 Iterations)
 {
+	SCOPE_CYCLE_COUNTER(STAT_VRMovementPhysClimbing);
+
 	if (deltaTime < MIN_TICK_TIME)
 	{
 		return;
@@ -872,10 +899,39 @@ void UVRBaseCharacterMovementComponent::PhysCustom_Climbing(float deltaTime, int
 	MaxStepHeight = VRClimbingStepHeight;
 	bool bSteppedUp = false;
 
+	bool bBroadphaseActive = false;
+	if (bUseClimbingBroadphase)
+	{
+		const FBox CapsuleBox = UpdatedComponent->Bounds.GetBox();
+		if (!ClimbingBroadphaseBounds.IsValid || !ClimbingBroadphaseBounds.IsInside(CapsuleBox.ShiftBy(Delta)) ||
+			(ClimbingBroadphaseRefreshInterval > 0.0f && GetWorld()->GetTimeSeconds() - ClimbingBroadphaseBuildTime > ClimbingBroadphaseRefreshInterval))
+		{
+			BuildClimbingBroadphase();
+		}
+
+		bBroadphaseActive = ClimbingBroadphaseBounds.IsValid != 0;
+	}
+
 	if (!bZeroDelta)
 	{
 		FHitResult Hit(1.f);
-		SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+		FBox SweptBox(ForceInit);
+		if (bBroadphaseActive)
+		{
+			const FBox CapsuleBox = UpdatedComponent->Bounds.GetBox();
+			SweptBox = (CapsuleBox + CapsuleBox.ShiftBy(Delta)).ExpandBy(KINDA_SMALL_NUMBER + MIN_FLOOR_DIST);
+		}
+
+		if (bBroadphaseActive && IsClimbingBroadphaseClear(SweptBox))
+		{
+			// Nothing local is in the way and nothing else can be, skip the world sweep
+			MoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), false);
+		}
+		else
+		{
+			SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, Hit);
+		}
 
 		if (Hit.Time < 1.f)
 		{
@@ -955,6 +1011,11 @@ void UVRBaseCharacterMovementComponent::PhysCustom_Climbing(float deltaTime, int
 	{
 		CurrentFloor = StepDownResult.FloorResult;
 	}
+	else if (bBroadphaseActive && IsClimbingBroadphaseClear(UpdatedComponent->Bounds.GetBox() + UpdatedComponent->Bounds.GetBox().ShiftBy(FVector(0.f, 0.f, -(MAX_FLOOR_DIST + MaxStepHeight)))))
+	{
+		// Nothing local below us within floor range, no floor to find
+		CurrentFloor.Clear();
+	}
 	else
 	{
 		FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, bZeroDelta, NULL);
@@ -988,8 +1049,75 @@ void UVRBaseCharacterMovementComponent::PhysCustom_Climbing(float deltaTime, int
 	}
 }
 
+void UVRBaseCharacterMovementComponent::BuildClimbingBroadphase()
+{
+	ClearClimbingBroadphase();
+
+	if (!UpdatedComponent || !GetWorld())
+		return;
+
+	FBox GatherBox = UpdatedComponent->Bounds.GetBox();
+
+	// Include the hands so that the surfaces we are climbing on are in the local set
+	if (BaseVRCharacterOwner)
+	{
+		if (BaseVRCharacterOwner->LeftMotionController)
+			GatherBox += BaseVRCharacterOwner->LeftMotionController->GetComponentLocation();
+
+		if (BaseVRCharacterOwner->RightMotionController)
+			GatherBox += BaseVRCharacterOwner->RightMotionController->GetComponentLocation();
+	}
+
+	GatherBox = GatherBox.ExpandBy(ClimbingBroadphaseExtent);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbingBroadphase), false, CharacterOwner);
+	FCollisionResponseParams ResponseParam;
+	InitCollisionParams(QueryParams, ResponseParam);
+
+	TArray<FOverlapResult> Overlaps;
+	GetWorld()->OverlapMultiByChannel(Overlaps, GatherBox.GetCenter(), FQuat::Identity, UpdatedComponent->GetCollisionObjectType(), FCollisionShape::MakeBox(GatherBox.GetExtent()), QueryParams, ResponseParam);
+
+	ClimbingBroadphaseComponents.Reserve(Overlaps.Num());
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		// Only things that would block the capsule matter to the sweeps
+		if (Overlap.bBlockingHit && Overlap.Component.IsValid())
+		{
+			ClimbingBroadphaseComponents.AddUnique(Overlap.Component);
+		}
+	}
+
+	ClimbingBroadphaseBounds = GatherBox;
+	ClimbingBroadphaseBuildTime = GetWorld()->GetTimeSeconds();
+}
+
+void UVRBaseCharacterMovementComponent::ClearClimbingBroadphase()
+{
+	ClimbingBroadphaseComponents.Reset();
+	ClimbingBroadphaseBounds.Init();
+}
+
+bool UVRBaseCharacterMovementComponent::IsClimbingBroadphaseClear(const FBox& TestBox) const
+{
+	if (!ClimbingBroadphaseBounds.IsValid || !ClimbingBroadphaseBounds.IsInside(TestBox))
+		return false;
+
+	for (const TWeakObjectPtr<UPrimitiveComponent>& Comp : ClimbingBroadphaseComponents)
+	{
+		// Using the live bounds so that movable components inside of the set are still respected
+		const UPrimitiveComponent* Prim = Comp.Get();
+		if (Prim && Prim->IsCollisionEnabled() && Prim->Bounds.GetBox().Intersect(TestBox))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 void UVRBaseCharacterMovementComponent::PhysCustom_LowGrav(float deltaTime, int32 Iterations)
 {
+	SCOPE_CYCLE_COUNTER(STAT_VRMovementPhysLowGrav);
 
 	if (deltaTime < MIN_TICK_TIME)
 	{
@@ -1234,6 +1362,17 @@ void  UVRBaseCharacterMovementComponent::SetUpdatedComponent(USceneComponent* Ne
 }
 
 
+bool UVRBaseCharacterMovementComponent::MoveUpdatedComponentImpl(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit, ETeleportType Teleport)
+{
+	if (bSweep)
+	{
+		INC_DWORD_STAT(STAT_VRMovementSweeps);
+		++FVRMovementQueryCounters::Sweeps;
+	}
+
+	return Super::MoveUpdatedComponentImpl(Delta, NewRotation, bSweep, OutHit, Teleport);
+}
+
 void UVRBaseCharacterMovementComponent::PerformMovement(float DeltaSeconds)
 {
 	// Scope these, they nest with Outer references so it should work fine
@@ -1655,7 +1794,8 @@ void UVRBaseCharacterMovementComponent::SmoothCorrection(const FVector& OldLocat
 		// Don't let the client fall too far behind or run ahead of new server time.
 		const double ServerDeltaTime = ClientData->SmoothingServerTimeStamp - OldServerTimeStamp;
 		const double MaxOffset = ClientData->MaxClientSmoothingDeltaTime;
-		const double MinOffset = FMath::Min(double(ClientData->SmoothNetUpdateTime), MaxOffset);
+		// Scale this corrections blend time by how fast the proxy is moving (1.0 unless unified smoothing is on)
+		const double MinOffset = FMath::Min(double(ClientData->SmoothNetUpdateTime * GetUnifiedSmoothingTimeScale()), MaxOffset);
 
 		// MaxDelta is the farthest behind we're allowed to be after receiving a new server time.
 		const double MaxDelta = FMath::Clamp(ServerDeltaTime * 1.25, MinOffset, MaxOffset);
@@ -1692,7 +1832,19 @@ void UVRBaseCharacterMovementComponent::SmoothClientPosition(float DeltaSeconds)
 		return;
 	}
 
-	SmoothClientPosition_Interpolate(DeltaSeconds);
+	FNetworkPredictionData_Client_Character* ClientData = GetPredictionData_Client_Character();
+	if (bUseUnifiedVRProxySmoothing && ClientData)
+	{
+		// Scale the exponential blend time for this interpolation only, the prediction data keeps its configured value
+		const float OriginalSmoothLocationTime = ClientData->SmoothLocationTime;
+		ClientData->SmoothLocationTime *= GetUnifiedSmoothingTimeScale();
+		SmoothClientPosition_Interpolate(DeltaSeconds);
+		ClientData->SmoothLocationTime = OriginalSmoothLocationTime;
+	}
+	else
+	{
+		SmoothClientPosition_Interpolate(DeltaSeconds);
+	}
 
 	//SmoothClientPosition_UpdateVisuals(); No mesh, don't bother to run this
 	SmoothClientPosition_UpdateVRVisuals();
@@ -1712,6 +1864,16 @@ void UVRBaseCharacterMovementComponent::SmoothClientPosition_UpdateVRVisuals()
 		{
 			// Erased most of the code here, check back in later
 			const FVector NewRelLocation = ClientData->MeshRotationOffset.UnrotateVector(ClientData->MeshTranslationOffset) + CharacterOwner->GetBaseTranslationOffset();
+
+			// Remaining error is below what is visible, finish the smoothing now so we stop moving the smoother and its attachments
+			if (bUseUnifiedVRProxySmoothing && ClientData->MeshTranslationOffset.SizeSquared() <= FMath::Square(UnifiedSmoothingVisualThreshold))
+			{
+				ClientData->MeshTranslationOffset = FVector::ZeroVector;
+				BaseVRCharacterOwner->NetSmoother->SetRelativeLocation(CharacterOwner->GetBaseTranslationOffset());
+				bNetworkSmoothingComplete = true;
+				return;
+			}
+
 			BaseVRCharacterOwner->NetSmoother->SetRelativeLocation(NewRelLocation);
 		}
 		else if (NetworkSmoothingMode == ENetworkSmoothingMode::Exponential)
@@ -1721,6 +1883,18 @@ void UVRBaseCharacterMovementComponent::SmoothClientPosition_UpdateVRVisuals()
 			const FQuat NewRelRotation = ClientData->MeshRotationOffset * CharacterOwner->GetBaseRotationOffset();
 			//Basechar->NetSmoother->SetRelativeLocation(NewRelTranslation);
 
+			// Remaining error is below what is visible, finish the smoothing now so we stop moving the smoother and its attachments
+			if (bUseUnifiedVRProxySmoothing && 
+				ClientData->MeshTranslationOffset.SizeSquared() <= FMath::Square(UnifiedSmoothingVisualThreshold) &&
+				ClientData->MeshRotationOffset.Equals(ClientData->MeshRotationTarget, SCENECOMPONENT_QUAT_TOLERANCE))
+			{
+				ClientData->MeshTranslationOffset = FVector::ZeroVector;
+				ClientData->MeshRotationOffset = ClientData->MeshRotationTarget;
+				BaseVRCharacterOwner->NetSmoother->SetRelativeLocationAndRotation(CharacterOwner->GetBaseTranslationOffset(), ClientData->MeshRotationOffset * CharacterOwner->GetBaseRotationOffset());
+				bNetworkSmoothingComplete = true;
+				return;
+			}
+
 			BaseVRCharacterOwner->NetSmoother->SetRelativeLocationAndRotation(NewRelTranslation, NewRelRotation);
 		}
 		else if (NetworkSmoothingMode == ENetworkSmoothingMode::Replay)
@@ -1738,6 +1912,16 @@ void UVRBaseCharacterMovementComponent::SmoothClientPosition_UpdateVRVisuals()
 	}
 }
 
+float UVRBaseCharacterMovementComponent::GetUnifiedSmoothingTimeScale() const
+{
+	if (!bUseUnifiedVRProxySmoothing)
+		return 1.0f;
+
+	// Fast moving proxies blend out their error quicker so they don't visibly trail, slow ones get the full time to hide it
+	const float SpeedAlpha = FMath::Clamp(Velocity.Size() / FMath::Max(UnifiedSmoothingReferenceSpeed, 1.0f), 0.0f, 1.0f);
+	return FMath::Lerp(1.0f, UnifiedSmoothingMinTimeScale, SpeedAlpha);
+}
+
 void UVRBaseCharacterMovementComponent::SetHasRequestedVelocity(bool bNewHasRequestedVelocity)
 {
 	bHasRequestedVelocity = bNewHasRequestedVelocity;
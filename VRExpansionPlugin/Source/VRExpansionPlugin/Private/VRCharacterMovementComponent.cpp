@@ -433,6 +433,8 @@ void FSavedMove_VRCharacter::PrepMoveFor(ACharacter* Character)
 void UVRCharacterMovementComponent::ServerMove_PerformMovement(const FCharacterNetworkMoveData& MoveData)
 {
 	QUICK_SCOPE_CYCLE_COUNTER(VRCharacterMovementServerMove_PerformMovement);
+	SCOPE_CYCLE_COUNTER(STAT_VRMovementServerMovePerform);
+	INC_DWORD_STAT(STAT_VRMovementServerMoves);
 	//SCOPE_CYCLE_COUNTER(STAT_VRCharacterMovementServerMove);
 	//CSV_SCOPED_TIMING_STAT(CharacterMovement, CharacterMovementServerMove);
 
@@ -811,6 +813,7 @@ bool UVRCharacterMovementComponent::ShouldCheckForValidLandingSpot(float DeltaTi
 void UVRCharacterMovementComponent::PhysWalking(float deltaTime, int32 Iterations)
 {
 	SCOPE_CYCLE_COUNTER(STAT_CharPhysWalking);
+	SCOPE_CYCLE_COUNTER(STAT_VRMovementPhysWalking);
 
 	if (deltaTime < MIN_TICK_TIME)
 	{
@@ -1317,6 +1320,7 @@ void UVRCharacterMovementComponent::ReplicateMoveToServer(float DeltaTime, const
 			SCOPE_CYCLE_COUNTER(STAT_CharacterMovementCallServerMove);
 			if (ShouldUsePackedMovementRPCs())
 			{
+				INC_DWORD_STAT(STAT_VRMovementClientMovesSent);
 				CallServerMovePacked(NewMove, ClientData->PendingMove.Get(), OldMove.Get());
 			}
 			/*else
@@ -2636,6 +2640,7 @@ void UVRCharacterMovementComponent::PhysFlying(float deltaTime, int32 Iterations
 void UVRCharacterMovementComponent::PhysFalling(float deltaTime, int32 Iterations)
 {
 	SCOPE_CYCLE_COUNTER(STAT_CharPhysFalling);
+	SCOPE_CYCLE_COUNTER(STAT_VRMovementPhysFalling);
 
 	if (deltaTime < MIN_TICK_TIME)
 	{
@@ -2995,6 +3000,7 @@ void UVRCharacterMovementComponent::PhysFalling(float deltaTime, int32 Iteration
 void UVRCharacterMovementComponent::PhysNavWalking(float deltaTime, int32 Iterations)
 {
 	SCOPE_CYCLE_COUNTER(STAT_CharPhysNavWalking);
+	SCOPE_CYCLE_COUNTER(STAT_VRMovementPhysNavWalking);
 
 	if (deltaTime < MIN_TICK_TIME)
 	{
@@ -7,11 +7,20 @@ UVRGlobalSettings::UVRGlobalSettings(const FObjectInitializer& ObjectInitializer
 	OneEuroMinCutoff(2.0f),
 	OneEuroCutoffSlope(0.007f),
 	OneEuroDeltaCutoff(1.0f),
+	bUseVRCharacterSignificance(false),
+	CharacterSignificanceUpdateInterval(0.25f),
+	CharacterSignificanceHysteresis(0.1f),
+	bDemoteOffScreenCharacters(true),
+	bUseBatchedInteractibleUpdates(false),
+	bMeleeSurfaceLookupTableBuilt(false),
 	CurrentControllerProfileInUse(NAME_None),
 	CurrentControllerProfileTransform(FTransform::Identity),
 	bUseSeperateHandTransforms(false),
 	CurrentControllerProfileTransformRight(FTransform::Identity)
 {
+	CharacterSignificanceTiers.Add(FBPVRCharacterSignificanceTier(1000.0f, 0.0f, false, false, false, false));
+	CharacterSignificanceTiers.Add(FBPVRCharacterSignificanceTier(3000.0f, 1.0f / 30.0f, true, true, false, true));
+	CharacterSignificanceTiers.Add(FBPVRCharacterSignificanceTier(6000.0f, 1.0f / 10.0f, true, true, true, true));
 }
 
 FTransform UVRGlobalSettings::AdjustTransformByControllerProfile(FName OptionalControllerProfileName, const FTransform& SocketTransform, bool bIsRightHand)
@@ -299,6 +308,38 @@ void UVRGlobalSettings::GetMeleeSurfaceGlobalSettings(TArray<FBPHitSurfaceProper
 	OutMeleeSurfaceSettings = VRSettings.MeleeSurfaceSettings;
 }
 
+const FBPHitSurfaceLookupTable& UVRGlobalSettings::GetMeleeSurfaceGlobalLookupTable()
+{
+	UVRGlobalSettings& VRSettings = *GetMutableDefault<UVRGlobalSettings>();
+
+	if (!VRSettings.bMeleeSurfaceLookupTableBuilt)
+	{
+		VRSettings.MeleeSurfaceLookupTable.Build(VRSettings.MeleeSurfaceSettings);
+		VRSettings.bMeleeSurfaceLookupTableBuilt = true;
+	}
+
+	return VRSettings.MeleeSurfaceLookupTable;
+}
+
+void UVRGlobalSettings::RebuildMeleeSurfaceGlobalLookupTable()
+{
+	UVRGlobalSettings& VRSettings = *GetMutableDefault<UVRGlobalSettings>();
+	VRSettings.bMeleeSurfaceLookupTableBuilt = false;
+}
+
+#if WITH_EDITOR
+void UVRGlobalSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Edits inside the surface list report the inner property, so check the member
+	if (PropertyChangedEvent.MemberProperty && PropertyChangedEvent.MemberProperty->GetFName() == GET_MEMBER_NAME_CHECKED(UVRGlobalSettings, MeleeSurfaceSettings))
+	{
+		bMeleeSurfaceLookupTableBuilt = false;
+	}
+}
+#endif
+
 void UVRGlobalSettings::GetVirtualStockGlobalSettings(FBPVirtualStockSettings& OutVirtualStockSettings)
 {
 	const UVRGlobalSettings& VRSettings = *GetDefault<UVRGlobalSettings>();
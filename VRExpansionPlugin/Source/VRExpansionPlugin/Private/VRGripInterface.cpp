@@ -8,4 +8,86 @@ UVRGripInterface::UVRGripInterface(const class FObjectInitializer& ObjectInitial
 	: Super(ObjectInitializer)
 {
  
-}
\ No newline at end of file
+}
+
+bool IVRGripInterface::HasBlueprintSnapshotOverrides(UClass* Class)
+{
+	static TMap<TWeakObjectPtr<UClass>, bool> ClassOverrides;
+
+	if (bool* bCachedOverrides = ClassOverrides.Find(Class))
+	{
+		return *bCachedOverrides;
+	}
+
+	static const FName SnapshotFunctionNames[] =
+	{
+		GET_FUNCTION_NAME_CHECKED(IVRGripInterface, GetPrimaryGripType),
+		GET_FUNCTION_NAME_CHECKED(IVRGripInterface, GripLateUpdateSetting),
+		GET_FUNCTION_NAME_CHECKED(IVRGripInterface, GripMovementReplicationType),
+		GET_FUNCTION_NAME_CHECKED(IVRGripInterface, GetGripStiffnessAndDamping),
+		GET_FUNCTION_NAME_CHECKED(IVRGripInterface, AdvancedGripSettings),
+		GET_FUNCTION_NAME_CHECKED(IVRGripInterface, GripBreakDistance)
+	};
+
+	bool bHasOverrides = false;
+	for (const FName& FunctionName : SnapshotFunctionNames)
+	{
+		// Blueprint overrides of native events are script functions, the native versions are flagged native
+		UFunction* Function = Class->FindFunctionByName(FunctionName);
+		if (Function && !Function->HasAnyFunctionFlags(FUNC_Native))
+		{
+			bHasOverrides = true;
+			break;
+		}
+	}
+
+	// Remove classes that were garbage collected (recompiled blueprints) so this doesn't grow forever
+	for (TMap<TWeakObjectPtr<UClass>, bool>::TIterator Itr = ClassOverrides.CreateIterator(); Itr; ++Itr)
+	{
+		if (!Itr.Key().IsValid())
+		{
+			Itr.RemoveCurrent();
+		}
+	}
+
+	ClassOverrides.Add(Class, bHasOverrides);
+	return bHasOverrides;
+}
+
+bool IVRGripInterface::GetNativeGripInterfaceSnapshot(bool bIsSlot, FVRGripInterfaceSnapshot& OutSnapshot)
+{
+	// These are virtual, so subclasses overriding them in C++ are respected the same as through the events
+	OutSnapshot.PrimaryGripType = GetPrimaryGripType_Implementation(bIsSlot);
+	OutSnapshot.LateUpdateSetting = GripLateUpdateSetting_Implementation();
+	OutSnapshot.MovementReplicationType = GripMovementReplicationType_Implementation();
+	GetGripStiffnessAndDamping_Implementation(OutSnapshot.ConstraintStiffness, OutSnapshot.ConstraintDamping);
+	OutSnapshot.ConstraintBreakDistance = GripBreakDistance_Implementation();
+	OutSnapshot.StoredAdvancedGripSettings = AdvancedGripSettings_Implementation();
+	OutSnapshot.AdvancedGripSettingsPtr = nullptr;
+	return true;
+}
+
+bool IVRGripInterface::TryGetNativeGripInterfaceSnapshot(UObject* Object, bool bIsSlot, FVRGripInterfaceSnapshot& OutSnapshot)
+{
+	// Only native implementers cast to the interface, blueprint implemented ones always use the events
+	if (IVRGripInterface* NativeInterface = Cast<IVRGripInterface>(Object))
+	{
+		return !HasBlueprintSnapshotOverrides(Object->GetClass()) && NativeInterface->GetNativeGripInterfaceSnapshot(bIsSlot, OutSnapshot);
+	}
+
+	return false;
+}
+
+void IVRGripInterface::GetGripInterfaceSnapshot(UObject* Object, bool bIsSlot, FVRGripInterfaceSnapshot& OutSnapshot)
+{
+	if (!Object || TryGetNativeGripInterfaceSnapshot(Object, bIsSlot, OutSnapshot))
+		return;
+
+	OutSnapshot.PrimaryGripType = Execute_GetPrimaryGripType(Object, bIsSlot);
+	OutSnapshot.LateUpdateSetting = Execute_GripLateUpdateSetting(Object);
+	OutSnapshot.MovementReplicationType = Execute_GripMovementReplicationType(Object);
+	Execute_GetGripStiffnessAndDamping(Object, OutSnapshot.ConstraintStiffness, OutSnapshot.ConstraintDamping);
+	OutSnapshot.ConstraintBreakDistance = Execute_GripBreakDistance(Object);
+	OutSnapshot.StoredAdvancedGripSettings = Execute_AdvancedGripSettings(Object);
+	OutSnapshot.AdvancedGripSettingsPtr = nullptr;
+}
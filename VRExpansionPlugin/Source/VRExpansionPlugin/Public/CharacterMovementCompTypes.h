@@ -14,6 +14,37 @@
 class AVRBaseCharacter;
 class UVRBaseCharacterMovementComponent;
 
+// Per frame locomotion counters, capture with "stat VRMovement" or a stats file on a -nullrhi dedicated server
+// to compare the VR and VRSimple movement components between builds.
+// The VRExpansionPlugin.Movement.Replay automation test drives a headless crowd through an input trace for a repeatable capture.
+DECLARE_STATS_GROUP(TEXT("VRMovement"), STATGROUP_VRMovement, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("VR Movement Sweeps"), STAT_VRMovementSweeps, STATGROUP_VRMovement, VREXPANSIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("VR Floor Traces"), STAT_VRMovementFloorTraces, STATGROUP_VRMovement, VREXPANSIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("VR Server Moves Processed"), STAT_VRMovementServerMoves, STATGROUP_VRMovement, VREXPANSIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("VR Client Moves Sent"), STAT_VRMovementClientMovesSent, STATGROUP_VRMovement, VREXPANSIONPLUGIN_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("VR Move Actions Performed"), STAT_VRMovementMoveActions, STATGROUP_VRMovement, VREXPANSIONPLUGIN_API);
+// Counts saved moves that had to be heap allocated, should sit at zero once the client free move pool is warm
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("VR SavedMove Allocations"), STAT_VRSavedMoveAllocations, STATGROUP_VRMovement, VREXPANSIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("VR ServerMove PerformMovement"), STAT_VRMovementServerMovePerform, STATGROUP_VRMovement, VREXPANSIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("VR PhysWalking"), STAT_VRMovementPhysWalking, STATGROUP_VRMovement, VREXPANSIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("VR PhysFalling"), STAT_VRMovementPhysFalling, STATGROUP_VRMovement, VREXPANSIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("VR PhysNavWalking"), STAT_VRMovementPhysNavWalking, STATGROUP_VRMovement, VREXPANSIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("VR PhysClimbing"), STAT_VRMovementPhysClimbing, STATGROUP_VRMovement, VREXPANSIONPLUGIN_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("VR PhysLowGrav"), STAT_VRMovementPhysLowGrav, STATGROUP_VRMovement, VREXPANSIONPLUGIN_API);
+
+// Running totals of the sweep and floor trace counters above, readable without stats enabled so automation tests can report them
+struct VREXPANSIONPLUGIN_API FVRMovementQueryCounters
+{
+	static uint32 Sweeps;
+	static uint32 FloorTraces;
+
+	static void Reset()
+	{
+		Sweeps = 0;
+		FloorTraces = 0;
+	}
+};
+
 UENUM(Blueprintable)
 enum class EVRMoveAction : uint8
 {
@@ -229,12 +260,18 @@ struct VREXPANSIONPLUGIN_API FVRMoveActionArray
 {
 	GENERATED_USTRUCT_BODY()
 public:
-	UPROPERTY()
-		TArray<FVRMoveActionContainer> MoveActions;
+
+	// Number of move actions stored inline before spilling to the heap, move actions are limited to a few per frame so this
+	// keeps recording, combining and copying saved moves allocation free.
+	static const int32 InlineMoveActionCount = 4;
+
+	// Not a UPROPERTY as reflected arrays can't use a custom allocator, this is only ever sent through our NetSerialize
+	TArray<FVRMoveActionContainer, TInlineAllocator<InlineMoveActionCount>> MoveActions;
 
 	void Clear()
 	{
-		MoveActions.Empty();
+		// Reset instead of Empty, we want to keep the storage
+		MoveActions.Reset();
 	}
 
 	/** Network serialization */
@@ -276,11 +313,10 @@ public:
 				else
 					MoveActionCount = 1;
 
+				MoveActions.Reserve(MoveActions.Num() + MoveActionCount);
 				for (int i = 0; i < MoveActionCount; i++)
 				{
-					FVRMoveActionContainer MoveAction;
-					bOutSuccess &= MoveAction.NetSerialize(Ar, Map, bOutSuccess);
-					MoveActions.Add(MoveAction);
+					bOutSuccess &= MoveActions.AddDefaulted_GetRef().NetSerialize(Ar, Map, bOutSuccess);
 				}
 			}
 		}
@@ -519,6 +555,7 @@ private:
 
 class VREXPANSIONPLUGIN_API FSavedMove_VRBaseCharacter : public FSavedMove_Character
 {
+	// VR payload is stored inline (see FVRMoveActionArray) so that pooled moves never need to re-allocate
 
 public:
 
@@ -544,6 +581,21 @@ public:
 	virtual bool IsImportantMove(const FSavedMovePtr& LastAckedMove) const override;
 };
 
+// Pre-warms the client saved move pools so that recording, combining and acking moves at 90-144hz does not allocate.
+// Moves are recycled through the engines FreeMoves list, this just makes sure that list and SavedMoves start at capacity.
+template<class SavedMoveType>
+void VRPrewarmClientSavedMoves(FNetworkPredictionData_Client_Character& ClientData, int32 PrewarmCount)
+{
+	PrewarmCount = FMath::Min(PrewarmCount, ClientData.MaxFreeMoveCount);
+	ClientData.SavedMoves.Reserve(ClientData.MaxSavedMoveCount);
+	ClientData.FreeMoves.Reserve(ClientData.MaxFreeMoveCount);
+
+	for (int32 i = 0; i < PrewarmCount; ++i)
+	{
+		ClientData.FreeMoves.Push(FSavedMovePtr(new SavedMoveType()));
+	}
+}
+
 // Using this fixes the problem where the character capsule isn't reset after a scoped movement update revert (pretty much just in StepUp operations)
 class VREXPANSIONPLUGIN_API FVRCharacterScopedMovementUpdate : public FScopedMovementUpdate
 {
@@ -286,6 +286,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GripMotionController")
 		void SetCustomPivotComponent(USceneComponent * NewCustomPivotComponent);
 
+	// Grip scripts are gathered once per grip, call this if you add or remove grip scripts on an object while it is held
+	UFUNCTION(BlueprintCallable, Category = "GripMotionController")
+		void InvalidateGripScriptPlans();
+
 	// Set the custom pivot component, allows you to use remote grips easier
 	UFUNCTION(BlueprintPure, Category = "GripMotionController", meta = (DisplayName = "GetPivotTransform"))
 		FTransform GetPivotTransform_BP();
@@ -1066,6 +1070,20 @@ public:
 
 	// Gets the world transform of a grip, modified by secondary grips, returns if it has a valid transform, if not then this tick will be skipped for the object
 	bool GetGripWorldTransform(TArray<UVRGripScriptBase*>& GripScripts, float DeltaTime,FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport, bool &bForceADrop);
+	bool GetGripWorldTransform(FVRGripScriptExecutionPlan& GripScriptPlan, float DeltaTime, FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport, bool &bForceADrop);
+
+	// Compiled grip script plans for the held grips, keyed by GripID
+	TMap<uint8, FVRGripScriptExecutionPlan> GripScriptPlans;
+
+	// Returns the plan for the grip, gathering the scripts from the interfaced object if it changed
+	FVRGripScriptExecutionPlan& GetGripScriptPlan(uint8 GripID, UObject* InterfaceObject);
+
+	// Removes a dropped grips plan, deferred until after the grip arrays are handled if a drop happens mid update
+	void RemoveGripScriptPlan(uint8 GripID);
+
+	// True while HandleGripArray is running and holding references into GripScriptPlans
+	bool bIsHandlingGripArrays;
+	TArray<uint8> PendingGripScriptPlanRemovals;
 
 	// Calculate component to world without the protected tag, doesn't set it, just returns it
 	inline FTransform CalcControllerComponentToWorld(FRotator Orientation, FVector Position)
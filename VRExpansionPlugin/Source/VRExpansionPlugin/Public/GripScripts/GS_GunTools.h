@@ -6,9 +6,11 @@
 #include "Engine/Engine.h"
 #include "VRGripScriptBase.h"
 #include "GripScripts/GS_Default.h"
+#include "Misc/VREuroFilterBank.h"
 #include "GS_GunTools.generated.h"
 
 class UGripMotionControllerComponent;
+class UVREuroFilterSubsystem;
 
 // Event thrown when we enter into virtual stock mode
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FVRVirtualStockModeChangedSignature, bool, IsVirtualStockEngaged);
@@ -157,8 +159,10 @@ public:
 	UGS_GunTools(const FObjectInitializer& ObjectInitializer);
 
 	virtual void OnGrip_Implementation(UGripMotionControllerComponent * GrippingController, const FBPActorGripInformation & GripInformation) override;
+	virtual void OnGripRelease_Implementation(UGripMotionControllerComponent * ReleasingController, const FBPActorGripInformation & GripInformation, bool bWasSocketed = false) override;
 	virtual void OnSecondaryGrip_Implementation(UGripMotionControllerComponent * Controller, USceneComponent * SecondaryGripComponent, const FBPActorGripInformation & GripInformation) override;
 	virtual void OnBeginPlay_Implementation(UObject* CallingOwner) override;
+	virtual void OnEndPlay_Implementation(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void HandlePrePhysicsHandle(UGripMotionControllerComponent* GrippingController, const FBPActorGripInformation &GripInfo, FBPActorPhysicsHandleInformation* HandleInfo, FTransform& KinPose) override;
 	//virtual void HandlePostPhysicsHandle(UGripMotionControllerComponent* GrippingController, FBPActorPhysicsHandleInformation* HandleInfo) override;
 
@@ -203,7 +207,7 @@ public:
 
 	void ResetStockVariables()
 	{
-		VirtualStockSettings.StockHandSmoothing.ResetSmoothingFilter();
+		ResetBankedSmoothing(StockHandFilterHandle, VirtualStockSettings.StockHandSmoothing);
 	}
 
 	void GetVirtualStockTarget(UGripMotionControllerComponent * GrippingController);
@@ -259,6 +263,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Recoil", meta = (editcondition = "bHasRecoil"))
 		float LerpRate;
 
+	// The recoil is stepped at this fixed rate (in seconds) so it feels the same at any headset refresh rate
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Recoil", meta = (editcondition = "bHasRecoil", ClampMin = "0.001", UIMin = "0.001"))
+		float RecoilFixedTimeStep;
+
 	// Stores the current amount of recoil
 	FTransform BackEndRecoilStorage;
 
@@ -266,6 +274,32 @@ public:
 	FTransform BackEndRecoilTarget;
 
 	bool bHasActiveRecoil;
+
+	// Runs the fixed steps for this frame and writes the recoil to apply, goes to sleep once it settles
+	void UpdateRecoil(float DeltaTime, FTransform & OutRecoil);
+
+private:
+
+	// Recoil at the last fixed step, we blend from it by the leftover time to avoid stepping artifacts
+	FTransform PreviousRecoilStorage;
+	float RecoilTimeAccumulator;
+
+	void StepRecoil(float StepTime);
+
+	// The stock hand and secondary smoothing run in the world's filter bank while the gun is held, registered on first use
+	FVREuroFilterHandle StockHandFilterHandle;
+	FVREuroFilterHandle SecondaryFilterHandle;
+	TWeakObjectPtr<UVREuroFilterSubsystem> FilterSubsystem;
+
+protected:
+
+	// Pushes this frames sample into the banked filter and returns its last output.
+	// Falls back to stepping the filter directly if there is no world to bank it in.
+	FVector RunBankedSmoothing(FVREuroFilterHandle& Handle, FBPEuroLowPassFilter& Filter, const FVector& InRawValue, float DeltaTime);
+	void ResetBankedSmoothing(FVREuroFilterHandle& Handle, FBPEuroLowPassFilter& Filter);
+	void ReleaseBankedSmoothing();
+
+public:
 	
 	// Adds a recoil instance to the gun tools, the option location is for if using the physical recoil mode
 	// Physical recoil is in world space and positional only, logical recoil is in relative space to the mesh itself and uses all
@@ -294,7 +328,7 @@ public:
 		{
 			if (!bSkipHighQualitySimulations && AdvSecondarySettings.SecondaryGripScaler < 1.0f)
 			{
-				SmoothedValue = AdvSecondarySettings.SecondarySmoothing.RunFilterSmoothing(frontLoc, DeltaTime);
+				SmoothedValue = RunBankedSmoothing(SecondaryFilterHandle, AdvSecondarySettings.SecondarySmoothing, frontLoc, DeltaTime);
 				frontLoc = FMath::Lerp(frontLoc, SmoothedValue, AdvSecondarySettings.SecondaryGripScaler);
 
 			}
@@ -302,7 +336,7 @@ public:
 		}
 		else if (!bSkipHighQualitySimulations && AdvSecondarySettings.bUseAdvancedSecondarySettings && AdvSecondarySettings.bUseConstantGripScaler) // If there is a frame by frame lerp
 		{
-			SmoothedValue = AdvSecondarySettings.SecondarySmoothing.RunFilterSmoothing(frontLoc, DeltaTime);
+			SmoothedValue = RunBankedSmoothing(SecondaryFilterHandle, AdvSecondarySettings.SecondarySmoothing, frontLoc, DeltaTime);
 			frontLoc = FMath::Lerp(frontLoc, SmoothedValue, AdvSecondarySettings.SecondaryGripScaler);
 		}
 
@@ -72,10 +72,29 @@ public:
 	UPROPERTY(Category = "LerpCurve", EditAnywhere, meta = (editcondition = "bUseCurve"))
 		FRuntimeFloatCurve OptionalCurveToFollow;
 
+	// How many samples of the curve to bake on grip, lerps then read the samples instead of searching the curve keys every frame
+	// 0 evaluates the curve directly, changing it re-bakes the samples on the next grip
+	UPROPERTY(Category = "LerpCurve", EditAnywhere, meta = (editcondition = "bUseCurve", ClampMin = "0", UIMin = "0", ClampMax = "1024", UIMax = "1024"))
+		int32 CurveCacheResolution;
+
+	// Rebakes the curve samples, call if the curve was changed after the object was first gripped
+	UFUNCTION(BlueprintCallable, Category = "LerpCurve")
+		void RefreshCurveCache();
+
 	FTransform OnGripTransform;
 
 	//virtual void BeginPlay_Implementation() override;
 	virtual bool GetWorldTransform_Implementation(UGripMotionControllerComponent * OwningController, float DeltaTime, FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport) override;
 	virtual void OnGrip_Implementation(UGripMotionControllerComponent * GrippingController, const FBPActorGripInformation & GripInformation) override;
 	virtual void OnGripRelease_Implementation(UGripMotionControllerComponent * ReleasingController, const FBPActorGripInformation & GripInformation, bool bWasSocketed) override;
+
+private:
+
+	// Baked curve values across 0.0 - 1.0
+	TArray<float> CachedCurveSamples;
+
+	// The CurveCacheResolution the samples were baked at, INDEX_NONE if they haven't been baked yet
+	int32 CachedCurveResolution;
+
+	float EvaluateCurve(FRichCurve * RichCurve, float Alpha) const;
 };
@@ -94,6 +94,58 @@ public:
 	}
 };
 
+// A list of surface properties indexed directly by surface type, so hits don't have to search the list
+struct VREXPANSIONPLUGIN_API FBPHitSurfaceLookupTable
+{
+	FBPHitSurfaceLookupTable()
+	{
+		Reset();
+	}
+
+	void Reset()
+	{
+		Entries.Reset();
+		for (int32 i = 0; i < SurfaceType_Max; ++i)
+		{
+			EntryIndices[i] = INDEX_NONE;
+		}
+	}
+
+	void Build(const TArray<FBPHitSurfaceProperties>& SurfaceSettings)
+	{
+		Reset();
+		Entries = SurfaceSettings;
+
+		for (int32 i = 0; i < Entries.Num(); ++i)
+		{
+			const uint8 SurfaceIndex = Entries[i].SurfaceType.GetValue();
+
+			// First entry for a surface wins, same as searching the list
+			if (SurfaceIndex < SurfaceType_Max && EntryIndices[SurfaceIndex] == INDEX_NONE)
+			{
+				EntryIndices[SurfaceIndex] = (int16)i;
+			}
+		}
+	}
+
+	int32 Num() const
+	{
+		return Entries.Num();
+	}
+
+	// Returns nullptr if the surface type isn't in the list
+	FORCEINLINE const FBPHitSurfaceProperties* Find(EPhysicalSurface SurfaceType) const
+	{
+		const int16 EntryIndex = EntryIndices[SurfaceType];
+		return EntryIndex != INDEX_NONE ? &Entries[EntryIndex] : nullptr;
+	}
+
+private:
+
+	TArray<FBPHitSurfaceProperties> Entries;
+	int16 EntryIndices[SurfaceType_Max];
+};
+
 // A Lodge component data struct
 USTRUCT(BlueprintType, Category = "Lodging")
 struct VREXPANSIONPLUGIN_API FBPLodgeComponentInfo
@@ -184,6 +236,9 @@ public:
 	UFUNCTION()
 	void OnLodgeHitCallback(AActor* SelfActor, AActor* OtherActor, FVector NormalImpulse, const FHitResult& Hit);
 
+	// Runs the lodge and hit logic for a hit, swept hits pass in the component that was swept
+	void HandleLodgeHit(AActor* OtherActor, const FVector& NormalImpulse, const FHitResult& Hit, const FBPLodgeComponentInfo* SweptLodgeComponent = nullptr);
+
 	UFUNCTION(BlueprintCallable, Category = "Weapon Settings")
 		void SetIsLodged(bool IsLodged, UPrimitiveComponent * LodgeComponent)
 	{
@@ -194,7 +249,7 @@ public:
 	bool bIsLodged;
 	TWeakObjectPtr<UPrimitiveComponent> LodgedComponent;
 
-	//virtual void Tick(float DeltaTime) override;
+	virtual void Tick(float DeltaTime) override;
 
 	// Thrown if we should lodge into a hit object
 	UPROPERTY(BlueprintAssignable, Category = "Melee|Lodging")
@@ -212,11 +267,46 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Lodging")
 		bool bOnlyPenetrateWithTwoHands;
 
+	// If true then the PenetrationNotifierComponents are swept from their last to their current transform every frame to find hits
+	// instead of using the physics hit events, this catches fast swings without needing to raise physics sub-stepping.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetUseSweptHitDetection, Category = "Melee|SweptHits")
+		bool bUseSweptHitDetection;
+
+	// Turns swept hit detection on or off, starting or stopping the swept hit tick to match
+	UFUNCTION(BlueprintCallable, Category = "Melee|SweptHits")
+		void SetUseSweptHitDetection(bool bNewUseSweptHitDetection);
+
+	// How many sweeps to split each frames movement into, more follows the arc of fast swings closer
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|SweptHits", meta = (ClampMin = "1", UIMin = "1", ClampMax = "8", UIMax = "8"))
+		int32 SweptHitSubSteps;
+
+	// Swept hits pass in sweep velocity * mass as their NormalImpulse, this scales it to line up with values tuned for physics hits
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|SweptHits")
+		float SweptHitImpulseScaler;
+
+	// Turns the swept hit tick on or off to match bCheckLodge
+	void UpdateSweptHitTicking();
+
+	// Sweeps all of the notifier components and then throws the events for what they hit
+	void PerformSweptHitDetection(float DeltaTime);
+
+	// Where the parent component was on the last swept hit check, sub-steps interpolate this and re-pose the notifiers off of it
+	// so that notifiers away from the pivot follow the arc of the swing.
+	FTransform LastSweptParentTransform;
+	bool bHasLastSweptParentTransform;
+
 	// A list of surface types that allow penetration and their properties
 	// If empty then the script will use the global settings, if filled with anything then it will override the global settings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Lodging")
 		TArray<FBPHitSurfaceProperties> OverrideMeleeSurfaceSettings;
 
+	// Lookup table of OverrideMeleeSurfaceSettings, built on begin play
+	FBPHitSurfaceLookupTable OverrideSurfaceLookupTable;
+
+	// Rebuilds the surface lookup table, call this if you alter the OverrideMeleeSurfaceSettings during play
+	UFUNCTION(BlueprintCallable, Category = "Melee|Lodging")
+		void RebuildSurfaceLookupTable();
+
 //	FVector RollingVelocityAverage;
 	//FVector RollingAngVelocityAverage;
 
@@ -284,8 +374,24 @@ public:
 
 	FTransform ObjectRelativeGripCenter;
 
+	// How far (in cm) the between hands center of mass has to move before we push it to the physics body again
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon Settings", meta = (ClampMin = "0.0", UIMin = "0.0"))
+		float COMUpdateTolerance;
+
 	void SetComBetweenHands(UGripMotionControllerComponent* GrippingController, FBPActorPhysicsHandleInformation * HandleInfo);
 
+	// The last center of mass we pushed to the body and the frame that we did it on, lets us skip the physics lock entirely when it hasn't moved
+	FVector LastComLocation;
+	bool bHasLastComLocation;
+	uint64 LastComWriteFrame;
+
+	// The body we are listening to mass updates on, a mass recalculation resets the center of mass so it invalidates the cache
+	TWeakObjectPtr<UPrimitiveComponent> ComBodyComponent;
+
+	// Forces the next SetComBetweenHands to write to the body, handle rebuilds and mass updates can both reset the com
+	void InvalidateComCache();
+	void OnParentMassRecalculated(FBodyInstance* BodyInstance);
+
 
 	// Grip settings to use on the primary hand when multiple grips are active
 	// Falls back to the standard grip settings when only one grip is active
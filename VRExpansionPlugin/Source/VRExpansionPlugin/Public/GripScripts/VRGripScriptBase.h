@@ -8,7 +8,6 @@
 #include "VRBPDatatypes.h"
 #include "Components/PrimitiveComponent.h"
 #include "GameFramework/Actor.h"
-#include "Tickable.h"
 #include "Net/UnrealNetwork.h"
 
 #include "VRGripScriptBase.generated.h"
@@ -30,7 +29,7 @@ enum class EGSTransformOverrideType : uint8
 };
 
 UCLASS(NotBlueprintable, BlueprintType, EditInlineNew, DefaultToInstanced, Abstract, ClassGroup = (VRExpansionPlugin), HideCategories = DefaultSettings)
-class VREXPANSIONPLUGIN_API UVRGripScriptBase : public UObject, public FTickableGameObject
+class VREXPANSIONPLUGIN_API UVRGripScriptBase : public UObject
 {
 	GENERATED_BODY()
 public:
@@ -135,7 +134,7 @@ public:
 	virtual bool CallRemoteFunction(UFunction * Function, void * Parms, FOutParmRec * OutParms, FFrame * Stack) override;
 	virtual int32 GetFunctionCallspace(UFunction * Function, FFrame * Stack) override;
 
-	// FTickableGameObject functions
+	// Tick functions, ticking scripts are run by the UVRGripScriptTickSubsystem grouped by class
 	
 	
 	// If true then this scrip can tick when bAllowticking is true
@@ -143,29 +142,37 @@ public:
 		bool bCanEverTick;
 
 	// If true and we bCanEverTick, then will fire off the tick function
-	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "TickSettings")
+	// Only constructors may write this directly (it is read when play begins), everything else has to go through SetTickEnabled.
+	// Blueprint sets are routed there already, a direct c++ write of true during play never registers the script with the tick subsystem.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, BlueprintSetter = SetTickEnabled, Category = "TickSettings")
 		bool bAllowTicking;
 
 	// Set whether the grip script can tick or not
 	UFUNCTION(BlueprintCallable, Category = "TickSettings")
 		void SetTickEnabled(bool bTickEnabled);
 
+	// Adds or removes us from the worlds tick subsystem to match IsTickable
+	void UpdateTickRegistration();
+
+private:
+
+	// The subsystem clears this on any scripts still registered when it goes away
+	friend class UVRGripScriptTickSubsystem;
+	bool bIsRegisteredForTick;
+
+public:
+
 	/**
 	 * Function called every frame on this GripScript. Override this function to implement custom logic to be executed every frame.
 	 * Only executes if bCanEverTick is true and bAllowTicking is true
 	 *
 	 * @param DeltaTime - The time since the last tick.
 	 */
-	virtual void Tick(float DeltaTime) override;
-	virtual bool IsTickable() const override;
-	virtual UWorld* GetTickableGameObjectWorld() const override;
-	virtual bool IsTickableInEditor() const;
-	virtual bool IsTickableWhenPaused() const override;
-	virtual ETickableTickType GetTickableTickType() const;
-	virtual TStatId GetStatId() const override;
+	virtual void Tick(float DeltaTime);
+	virtual bool IsTickable() const;
 	virtual UWorld* GetWorld() const override;
 
-	// End tickable object information
+	// End tick functions
 
 
 	// Returns the expected grip transform (relative * controller + addition)
@@ -268,4 +275,99 @@ public:
 	/** Event called every frame if ticking is enabled */
 	UFUNCTION(BlueprintImplementableEvent, meta = (DisplayName = "Tick"))
 		void ReceiveTick(float DeltaSeconds);
+};
+// Phase that an active grip script runs in when building the grip world transform
+enum class EGSExecutionPhase : uint8
+{
+	// Replaces the default grip scripts transform
+	Override,
+
+	// Modifies the transform after the default / overriding scripts
+	Modifier
+};
+
+// A grips scripts compiled into the ordered list of active transform steps.
+// Scripts are gathered once per grip and the steps are only rebuilt when a script changes its active state or transform type.
+// The plan lives across frames outside of the GC's view, so scripts are held weakly and a collected script forces a re-gather.
+struct VREXPANSIONPLUGIN_API FVRGripScriptExecutionPlan
+{
+	struct FStep
+	{
+		TWeakObjectPtr<UVRGripScriptBase> Script;
+		EGSExecutionPhase Phase;
+	};
+
+	// The object the scripts were gathered from, a different object means they need to be gathered again
+	TWeakObjectPtr<UObject> GrippedObject;
+	bool bHasGatheredScripts;
+
+	// Every script on the gripped object
+	TArray<TWeakObjectPtr<UVRGripScriptBase>> Scripts;
+
+	// Active transform scripts in script order
+	TArray<FStep, TInlineAllocator<4>> TransformSteps;
+
+	// If any active script overrides the default grip script
+	bool bOverridesDefaultTransform;
+
+	FVRGripScriptExecutionPlan() :
+		bHasGatheredScripts(false),
+		bOverridesDefaultTransform(false)
+	{}
+
+	// Rebuilds the steps if any script changed state since the last build
+	void Refresh()
+	{
+		bool bNeedsRebuild = ScriptStates.Num() != Scripts.Num();
+
+		for (int32 i = 0; !bNeedsRebuild && i < Scripts.Num(); ++i)
+		{
+			bNeedsRebuild = ScriptStates[i] != GetScriptState(Scripts[i].Get());
+		}
+
+		if (bNeedsRebuild)
+		{
+			Rebuild();
+		}
+	}
+
+	void Rebuild();
+
+	// True if one of the gathered scripts was garbage collected since it was gathered
+	bool HasStaleScripts() const
+	{
+		for (const TWeakObjectPtr<UVRGripScriptBase>& Script : Scripts)
+		{
+			if (Script.IsStale())
+				return true;
+		}
+
+		return false;
+	}
+
+	// Copies out the scripts that are still alive
+	void GetScripts(TArray<UVRGripScriptBase*>& OutScripts) const
+	{
+		OutScripts.Reset(Scripts.Num());
+		for (const TWeakObjectPtr<UVRGripScriptBase>& Script : Scripts)
+		{
+			if (UVRGripScriptBase* ValidScript = Script.Get())
+			{
+				OutScripts.Add(ValidScript);
+			}
+		}
+	}
+
+private:
+
+	// Packed active state and transform type of each script when last built
+	TArray<uint8, TInlineAllocator<8>> ScriptStates;
+
+	static FORCEINLINE uint8 GetScriptState(const UVRGripScriptBase* Script)
+	{
+		if (!Script || !Script->bIsActive)
+			return 0;
+
+		return 1 + (uint8)Script->WorldTransformOverrideType;
+	}
 };
\ No newline at end of file
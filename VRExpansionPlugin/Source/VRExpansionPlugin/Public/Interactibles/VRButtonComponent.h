@@ -60,7 +60,17 @@ public:
 	UFUNCTION()
 	void OnOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
 
+	// Starts an interaction with the component if it is valid and the button isn't already in use, returns true if it started.
+	// Called from the overlap events or from a UVRButtonPanelComponent when the button is panel driven.
+	bool BeginButtonInteraction(UPrimitiveComponent* OtherComp);
+
+	// Ends the interaction if the component is the one currently interacting
+	void EndButtonInteraction(UPrimitiveComponent* OtherComp);
+
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+
+	// Per frame update while held or lerping, called from TickComponent or the UVRInteractibleUpdateSubsystem when batched
+	void TickInteractible(float DeltaTime);
 	virtual void BeginPlay() override;
 
 	UFUNCTION(BlueprintPure, Category = "VRButtonComponent")
@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/BoxComponent.h"
+#include "VRButtonPanelComponent.generated.h"
+
+class UVRButtonComponent;
+
+/**
+* A single overlap volume for keypad style panels with many buttons.
+* The panel gathers hand overlaps once and dispatches them to the buttons that they are over,
+* the registered buttons stop generating their own overlap events while they are panel driven.
+*/
+UCLASS(Blueprintable, meta = (BlueprintSpawnableComponent), ClassGroup = (VRExpansionPlugin))
+class VREXPANSIONPLUGIN_API UVRButtonPanelComponent : public UBoxComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVRButtonPanelComponent(const FObjectInitializer& ObjectInitializer);
+
+	UFUNCTION()
+	void OnPanelOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	UFUNCTION()
+	void OnPanelOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+
+	// If true then all VRButtonComponents attached below this panel are registered to it on begin play
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRButtonPanelComponent")
+		bool bAutoRegisterChildButtons;
+
+	// Extra distance added to the button bounds when testing if an overlapping component is over a button
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRButtonPanelComponent", meta = (ClampMin = "0.0", UIMin = "0.0"))
+		float ButtonBoundsPadding;
+
+	// Makes the button panel driven, it will no longer generate its own overlap events
+	UFUNCTION(BlueprintCallable, Category = "VRButtonPanelComponent")
+		void RegisterButton(UVRButtonComponent* Button);
+
+	// Returns the button to generating its own overlap events
+	UFUNCTION(BlueprintCallable, Category = "VRButtonPanelComponent")
+		void UnregisterButton(UVRButtonComponent* Button);
+
+	UFUNCTION(BlueprintPure, Category = "VRButtonPanelComponent")
+		int32 GetNumRegisteredButtons() const { return PanelButtons.Num(); }
+
+protected:
+
+	struct FVRPanelButtonEntry
+	{
+		TWeakObjectPtr<UVRButtonComponent> Button;
+
+		// The component that we started an interaction on this button with
+		TWeakObjectPtr<UPrimitiveComponent> InteractingComponent;
+	};
+
+	TArray<FVRPanelButtonEntry> PanelButtons;
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> OverlappingComponents;
+
+	// Ends stale interactions and begins new ones for the buttons under the overlapping components
+	void UpdatePanelButtons();
+};
@@ -55,6 +55,106 @@ public:
 	FTransform ReversedRelativeTransform;
 };
 
+// Compact replicated state of an interactible, used in place of replicating the full relative transform.
+// Holds up to three 16 bit quantized values (a progress / angle or the three axis of a relative rotation),
+// only the values that are non zero are sent so a single axis interactible costs a little over two bytes.
+// Clients rebuild their transform from it and their InitialRelativeTransform.
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FBPVRInteractibleCompactState
+{
+	GENERATED_BODY()
+public:
+
+	uint16 Values[3];
+
+	FBPVRInteractibleCompactState()
+	{
+		Values[0] = Values[1] = Values[2] = 0;
+	}
+
+	FORCEINLINE bool operator==(const FBPVRInteractibleCompactState& Other) const
+	{
+		return Values[0] == Other.Values[0] && Values[1] == Other.Values[1] && Values[2] == Other.Values[2];
+	}
+
+	FORCEINLINE bool operator!=(const FBPVRInteractibleCompactState& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	// Stores a value in the [Min, Max] range in the first slot
+	FORCEINLINE void SetScalar(float Value, float Min, float Max)
+	{
+		const float Alpha = (Max > Min) ? FMath::Clamp((Value - Min) / (Max - Min), 0.0f, 1.0f) : 0.0f;
+		Values[0] = (uint16)FMath::RoundToInt(Alpha * 65535.0f);
+		Values[1] = Values[2] = 0;
+	}
+
+	FORCEINLINE float GetScalar(float Min, float Max) const
+	{
+		return FMath::Lerp(Min, Max, (float)Values[0] / 65535.0f);
+	}
+
+	// Stores a per axis [0, 1] alpha in each of the three slots
+	FORCEINLINE void SetUnitVector(const FVector& Alpha)
+	{
+		Values[0] = (uint16)FMath::RoundToInt(FMath::Clamp(Alpha.X, 0.0f, 1.0f) * 65535.0f);
+		Values[1] = (uint16)FMath::RoundToInt(FMath::Clamp(Alpha.Y, 0.0f, 1.0f) * 65535.0f);
+		Values[2] = (uint16)FMath::RoundToInt(FMath::Clamp(Alpha.Z, 0.0f, 1.0f) * 65535.0f);
+	}
+
+	FORCEINLINE FVector GetUnitVector() const
+	{
+		return FVector((float)Values[0] / 65535.0f, (float)Values[1] / 65535.0f, (float)Values[2] / 65535.0f);
+	}
+
+	FORCEINLINE void SetRotator(const FRotator& Rotation)
+	{
+		Values[0] = FRotator::CompressAxisToShort(Rotation.Pitch);
+		Values[1] = FRotator::CompressAxisToShort(Rotation.Yaw);
+		Values[2] = FRotator::CompressAxisToShort(Rotation.Roll);
+	}
+
+	FORCEINLINE FRotator GetRotator() const
+	{
+		return FRotator(FRotator::DecompressAxisFromShort(Values[0]), FRotator::DecompressAxisFromShort(Values[1]), FRotator::DecompressAxisFromShort(Values[2]));
+	}
+
+	/** Network serialization */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		bOutSuccess = true;
+
+		for (int32 Index = 0; Index < 3; ++Index)
+		{
+			uint8 bHasValue = Values[Index] != 0;
+			Ar.SerializeBits(&bHasValue, 1);
+
+			if (bHasValue)
+			{
+				Ar << Values[Index];
+			}
+			else
+			{
+				Values[Index] = 0;
+			}
+		}
+
+		return bOutSuccess;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits< FBPVRInteractibleCompactState > : public TStructOpsTypeTraitsBase2<FBPVRInteractibleCompactState>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithNetSharedSerialization = true,
+		WithIdenticalViaEquality = true
+	};
+};
+
 UCLASS()
 class VREXPANSIONPLUGIN_API UVRInteractibleFunctionLibrary : public UBlueprintFunctionLibrary
 {
@@ -120,6 +120,20 @@ public:
 	UPROPERTY(EditAnywhere, Replicated, BlueprintReadWrite, Category = "VRGripInterface|Replication")
 		bool bReplicateMovement;
 
+	// If true the state is replicated as a few quantized bytes instead of the full relative transform when bReplicateMovement is on,
+	// clients rebuild their transform from it and the InitialRelativeTransform.
+	UPROPERTY(EditAnywhere, Replicated, BlueprintReadWrite, Category = "VRGripInterface|Replication")
+		bool bUseCompactStateReplication;
+
+	UPROPERTY(Transient, ReplicatedUsing = OnRep_CompactState)
+		FBPVRInteractibleCompactState CompactState;
+
+	UFUNCTION()
+		virtual void OnRep_CompactState();
+
+	// Fills in the CompactState from our current state, called on the server prior to replication
+	void UpdateCompactState();
+
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	virtual void BeginPlay() override;
 
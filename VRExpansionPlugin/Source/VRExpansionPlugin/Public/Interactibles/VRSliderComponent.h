@@ -36,6 +36,48 @@ enum class EVRInteractibleSliderDropBehavior : uint8
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FVRSliderHitPointSignature, float, SliderProgressPoint);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FVRSliderFinishedLerpingSignature, float, FinalProgress);
 
+/**
+* Arc length parameterized samples of a spline in its local space, built from the splines reparam table.
+* Segments between samples are bucketed into a uniform grid so that closest point queries only visit nearby segments
+* instead of walking every spline segment with a newton refinement.
+*/
+struct VREXPANSIONPLUGIN_API FVRSliderSplineLookupTable
+{
+	TArray<FVector> Locations;
+	TArray<float> InputKeys;
+
+	// Grid cell -> index of the samples starting the segments overlapping that cell
+	TMap<FIntVector, TArray<int32>> Buckets;
+	float BucketSize;
+	FIntVector MinCell;
+	FIntVector MaxCell;
+
+	// What the table was built from, used to detect changes to the spline
+	TWeakObjectPtr<USplineComponent> Spline;
+	int32 NumSplinePoints;
+	float SplineLength;
+
+	FVRSliderSplineLookupTable() :
+		BucketSize(1.0f),
+		MinCell(FIntVector::ZeroValue),
+		MaxCell(FIntVector::ZeroValue),
+		NumSplinePoints(0),
+		SplineLength(0.0f)
+	{}
+
+	void Build(USplineComponent* InSpline);
+	void Reset();
+	bool IsValidFor(const USplineComponent* InSpline) const;
+
+	// Returns the input key of the closest point on the spline to a location in the splines local space
+	float FindInputKeyClosestToLocalLocation(const FVector& LocalLocation) const;
+
+	FORCEINLINE FIntVector GetCell(const FVector& LocalLocation) const
+	{
+		return FIntVector(FMath::FloorToInt(LocalLocation.X / BucketSize), FMath::FloorToInt(LocalLocation.Y / BucketSize), FMath::FloorToInt(LocalLocation.Z / BucketSize));
+	}
+};
+
 /**
 * A slider component, can act like a scroll bar, or gun bolt, or spline following component
 */
@@ -149,6 +191,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRSliderComponent")
 	bool bFollowSplineRotationAndScale;
 
+	// If true a cached arc length lookup table of the spline is used to find the closest point on it instead of
+	// searching the spline every grip tick. The table is rebuilt when the spline is assigned or its points / length change.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRSliderComponent")
+		bool bUseSplineLookupTable;
+
+	FVRSliderSplineLookupTable SplineLookupTable;
+
+	// Rebuilds the spline lookup table, only needed if the spline was changed without changing its point count or length
+	UFUNCTION(BlueprintCallable, Category = "VRSliderComponent")
+		void RebuildSplineLookupTable();
+
+	// Finds the closest input key on the followed spline, uses the lookup table if enabled
+	float FindSplineInputKeyClosestToWorldLocation(const FVector& WorldLocation);
+
 	// Does not allow the slider to skip past nodes on the spline, it requires it to progress from node to node
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRSliderComponent")
 		bool bEnforceSplineLinearity;
@@ -229,6 +285,9 @@ public:
 	float GetCurrentSliderProgress(FVector CurLocation, bool bUseKeyInstead = false, float CurKey = 0.f);
 	FVector ClampSlideVector(FVector ValueToClamp);
 
+	// Gets the per axis start offset and travel distance used by ClampSlideVector
+	void GetSlideExtents(FVector& OutMinScale, FVector& OutDist) const;
+
 	// ------------------------------------------------
 	// Gameplay tag interface
 	// ------------------------------------------------
@@ -256,7 +315,25 @@ public:
 	UPROPERTY(EditAnywhere, Replicated, BlueprintReadWrite, Category = "VRGripInterface|Replication")
 		bool bReplicateMovement;
 
+	// If true the state is replicated as a few quantized bytes instead of the full relative transform when bReplicateMovement is on,
+	// clients rebuild their transform from it and the InitialRelativeTransform.
+	UPROPERTY(EditAnywhere, Replicated, BlueprintReadWrite, Category = "VRGripInterface|Replication")
+		bool bUseCompactStateReplication;
+
+	UPROPERTY(Transient, ReplicatedUsing = OnRep_CompactState)
+		FBPVRInteractibleCompactState CompactState;
+
+	UFUNCTION()
+		virtual void OnRep_CompactState();
+
+	// Fills in the CompactState from our current state, called on the server prior to replication
+	// Spline sliders send their scalar progress, free sliders send a quantized per axis progress so multi axis slides stay exact
+	void UpdateCompactState();
+
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+
+	// Per frame update while held or lerping, called from TickComponent or the UVRInteractibleUpdateSubsystem when batched
+	void TickInteractible(float DeltaTime);
 	virtual void BeginPlay() override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRGripInterface")
@@ -7,6 +7,7 @@
 #include "AIModule/Classes/GenericTeamAgentInterface.h"
 #include "AIModule/Classes/Perception/AISense.h"
 #include "AIModule/Classes/Perception/AISenseConfig.h"
+#include "WorldCollision.h"
 
 #include "VRAIPerceptionOverrides.generated.h"
 
@@ -95,6 +96,17 @@ struct VREXPANSIONPLUGIN_API FAISightEventVR
 	}
 };
 
+// Which part of a VR character was seen, passed along as the stimulus tag when using the VR body visibility profile
+UENUM(BlueprintType)
+enum class EVRSightBodyPart : uint8
+{
+	None,
+	Head,
+	LeftHand,
+	RightHand,
+	Body
+};
+
 struct FAISightTargetVR
 {
 	typedef uint32 FTargetId;
@@ -126,12 +138,13 @@ struct FAISightQueryVR
 	float Importance;
 
 	FVector LastSeenLocation;
+	EVRSightBodyPart LastSeenBodyPart;
 
 	uint64 bLastResult : 1;
 	uint64 LastProcessedFrameNumber : 63;
 
 	FAISightQueryVR(FPerceptionListenerID ListenerId = FPerceptionListenerID::InvalidID(), FAISightTargetVR::FTargetId Target = FAISightTargetVR::InvalidTargetId)
-		: ObserverId(ListenerId), TargetId(Target), Score(0), Importance(0), LastSeenLocation(FAISystem::InvalidLocation), bLastResult(false), LastProcessedFrameNumber(GFrameCounter)
+		: ObserverId(ListenerId), TargetId(Target), Score(0), Importance(0), LastSeenLocation(FAISystem::InvalidLocation), LastSeenBodyPart(EVRSightBodyPart::None), bLastResult(false), LastProcessedFrameNumber(GFrameCounter)
 	{
 	}
 
@@ -153,9 +166,30 @@ struct FAISightQueryVR
 	void ForgetPreviousResult()
 	{
 		LastSeenLocation = FAISystem::InvalidLocation;
+		LastSeenBodyPart = EVRSightBodyPart::None;
 		bLastResult = false;
 	}
 
+	// Score is Age + Importance, since the current frame is the same for every query the ordering only depends on
+	// Importance - LastProcessedFrameNumber which doesn't change until the query is processed again.
+	double GetPriorityKey() const
+	{
+		return (double)Importance - (double)LastProcessedFrameNumber;
+	}
+
+	// Max heap on the priority key, lets the queries be updated incrementally instead of resorted every update
+	class FHeapPredicate
+	{
+	public:
+		FHeapPredicate()
+		{}
+
+		bool operator()(const FAISightQueryVR& A, const FAISightQueryVR& B) const
+		{
+			return A.GetPriorityKey() > B.GetPriorityKey();
+		}
+	};
+
 	class FSortPredicate
 	{
 	public:
@@ -192,13 +226,20 @@ public:
 	TMap<FPerceptionListenerID, FDigestedSightProperties> DigestedProperties;
 
 	/** The SightQueries are a n^2 problem and to reduce the sort time, they are now split between in range and out of range */
-	/** Since the out of range queries only age as the distance component of the score is always 0, there is few need to sort them */
-	/** In the majority of the cases most of the queries are out of range, so the sort time is greatly reduced as we only sort the in range queries */
-	int32 NextOutOfRangeIndex = 0;
+	/** Both lists are kept as binary heaps on FAISightQueryVR::GetPriorityKey, processed queries are popped and pushed back */
+	/** so the per update cost scales with the queries processed, a full heapify only happens after adds / removes */
 	bool bSightQueriesOutOfRangeDirty = true;
+	bool bSightQueriesInRangeDirty = true;
 	TArray<FAISightQueryVR> SightQueriesOutOfRange;
 	TArray<FAISightQueryVR> SightQueriesInRange;
 
+	/** Observer / target pair -> position in its heap, stored as (Index << 1) | 1 for SightQueriesInRange and (Index << 1) for SightQueriesOutOfRange */
+	/** Kept in sync by the heap operations below and rebuilt along with the heaps, only valid while neither heap is dirty */
+	TMap<uint64, int32> SightQueryIndices;
+
+	// Scratch list of the queries processed in the current update
+	TArray<FAISightQueryVR> ProcessedSightQueries;
+
 protected:
 	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
 		int32 MaxTracesPerTick;
@@ -220,8 +261,82 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
 		float SightLimitQueryImportance;
 
+	// If true line of sight checks are submitted as batched async traces and the results are consumed on the next update.
+	// This decouples the number of traces from game thread time, targets implementing CanBeSeenFrom are still checked synchronously.
+	// Only the preferred sight point is traced first, the rest are submitted on the following update if it wasn't visible.
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
+		bool bUseAsyncSightTraces;
+
+	// Max async traces to submit per update when bUseAsyncSightTraces is enabled, replaces MaxTracesPerTick in that mode
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config, meta = (EditCondition = "bUseAsyncSightTraces"))
+		int32 MaxAsyncTracesPerTick;
+
+	// If true VR characters are tested at their head, both controllers and their body instead of a single location.
+	// The part seen last is tested first and the check stops on the first visible point, the seen part is passed as the stimulus tag.
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
+		bool bUseVRBodyVisibilityProfile;
+
+	// If true targets and listeners are bucketed into a 2D grid and queries are only generated for pairs within sight range (+ three cells).
+	// Pairs that drift far out of range are culled on the refresh and re-created when they get close again, keeps the query count
+	// from growing n^2 in large levels.
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
+		bool bUseSightSpatialHash;
+
+	// Size of a spatial hash cell in cm, should be around the common sight radius
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config, meta = (EditCondition = "bUseSightSpatialHash", ClampMin = "100.0", UIMin = "100.0"))
+		float SightSpatialHashCellSize;
+
+	// How often in seconds to re-bucket targets and listeners and refresh the pairs
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config, meta = (EditCondition = "bUseSightSpatialHash", ClampMin = "0.0", UIMin = "0.0"))
+		float SightSpatialHashUpdateInterval;
+
+	// Cell -> Ids in it, and the reverse lookup of the cell that each Id is currently in
+	TMap<FIntPoint, TArray<FAISightTargetVR::FTargetId>> SpatialHashTargetCells;
+	TMap<FAISightTargetVR::FTargetId, FIntPoint> SpatialHashTargetLookup;
+	TMap<FIntPoint, TArray<FPerceptionListenerID>> SpatialHashListenerCells;
+	TMap<FPerceptionListenerID, FIntPoint> SpatialHashListenerLookup;
+
+	// Largest listener range in the hash, used to find the listeners that could see a target
+	float MaxSpatialHashListenerRange;
+	float NextSpatialHashUpdateTime;
+
 	ECollisionChannel DefaultSightCollisionChannel;
 
+	// A single location to check line of sight to
+	struct FSightPointVR
+	{
+		FVector Location;
+		EVRSightBodyPart BodyPart;
+		FTraceHandle TraceHandle;
+		bool bSubmitted;
+		bool bFinished;
+		bool bVisible;
+
+		FSightPointVR() {}
+		FSightPointVR(const FVector& InLocation, EVRSightBodyPart InBodyPart) :
+			Location(InLocation), BodyPart(InBodyPart), bSubmitted(false), bFinished(false), bVisible(false)
+		{}
+	};
+
+	typedef TArray<FSightPointVR, TInlineAllocator<4>> FSightPointsVR;
+
+	// A batch of async traces for one query that has been submitted and is waiting on its results
+	struct FPendingSightTraceVR
+	{
+		FSightPointsVR SightPoints;
+		FVector TargetLocation;
+		FPerceptionListenerID ObserverId;
+		FAISightTargetVR::FTargetId TargetId;
+	};
+
+	// Keyed by observer / target pair, only one trace is allowed in flight per pair
+	TMap<uint64, FPendingSightTraceVR> PendingAsyncSightTraces;
+
+	static FORCEINLINE uint64 GetSightQueryKey(const FPerceptionListenerID& ObserverId, FAISightTargetVR::FTargetId TargetId)
+	{
+		return ((uint64)(uint32)ObserverId << 32) | (uint64)TargetId;
+	}
+
 public:
 
 	virtual void PostInitProperties() override;
@@ -234,11 +349,29 @@ public:
 	virtual void OnListenerForgetsActor(const FPerceptionListener& Listener, AActor& ActorToForget) override;
 	virtual void OnListenerForgetsAll(const FPerceptionListener& Listener) override;
 
+	// Returns the body part that the listener last saw of the target, None if not seen or not using the VR body visibility profile
+	UFUNCTION(BlueprintCallable, Category = "AI Perception")
+		EVRSightBodyPart GetLastSeenBodyPart(UAIPerceptionComponent* Listener, AActor* Target) const;
+
+	static FName GetSightBodyPartTag(EVRSightBodyPart BodyPart);
+
 protected:
 	virtual float Update() override;
 
 	virtual bool ShouldAutomaticallySeeTarget(const FDigestedSightProperties& PropDigest, FAISightQueryVR* SightQuery, FPerceptionListener& Listener, AActor* TargetActor, float& OutStimulusStrength) const;
 
+	// Registers the stimulus for a finished line of sight check and updates the query
+	void OnLineOfSightResult(FPerceptionListener& Listener, FAISightQueryVR& SightQuery, AActor* TargetActor, const FVector& TargetLocation, bool bVisible, EVRSightBodyPart SeenBodyPart = EVRSightBodyPart::None);
+
+	// Fills in the locations to test for a target, ordered so that the last seen body part comes first
+	void GatherSightPoints(const AActor* TargetActor, const FVector& TargetLocation, EVRSightBodyPart PreferredBodyPart, FSightPointsVR& OutSightPoints) const;
+
+	// Consumes any finished async traces from the last update, returns the number of follow up traces it submitted
+	int32 ProcessAsyncSightTraces(UWorld* World);
+
+	// Submits async traces for Count sight points starting at FirstIndex, returns the number submitted
+	int32 SubmitSightPointTraces(UWorld* World, FPendingSightTraceVR& PendingTrace, const FVector& ObserverLocation, const AActor* IgnoreActor, int32 FirstIndex, int32 Count) const;
+
 	void OnNewListenerImpl(const FPerceptionListener& NewListener);
 	void OnListenerUpdateImpl(const FPerceptionListener& UpdatedListener);
 	void OnListenerRemovedImpl(const FPerceptionListener& RemovedListener);
@@ -255,6 +388,39 @@ protected:
 
 	float CalcQueryImportance(const FPerceptionListener& Listener, const FVector& TargetLocation, const float SightRadiusSq) const;
 
+	// Indexed heap operations on the query lists, these keep SightQueryIndices in sync
+	void SightQueryHeapPush(bool bInRange, const FAISightQueryVR& SightQuery);
+	void SightQueryHeapPop(bool bInRange, FAISightQueryVR& OutSightQuery);
+	void SightQueryHeapSiftUp(bool bInRange, int32 Index);
+	void SightQueryHeapSiftDown(bool bInRange, int32 Index);
+	void SetSightQueryIndex(bool bInRange, int32 Index);
+
+	// Heapifies whichever query list was changed outside of the update and rebuilds the pair index
+	void RebuildSightQueryHeaps();
+
+	// Finds the query for an observer / target pair, a single map lookup unless the heaps are waiting on a rebuild
+	const FAISightQueryVR* FindSightQuery(const FPerceptionListenerID& ObserverId, FAISightTargetVR::FTargetId TargetId) const;
+	FAISightQueryVR* FindSightQuery(const FPerceptionListenerID& ObserverId, FAISightTargetVR::FTargetId TargetId);
+
+	// Creates a query for the pair in the correct range list and marks it dirty
+	FAISightQueryVR& AddSightQuery(const FPerceptionListener& Listener, const FDigestedSightProperties& PropDigest, FAISightTargetVR::FTargetId TargetId, const FVector& TargetLocation);
+
+	// Spatial hash helpers
+	FIntPoint GetSpatialHashCell(const FVector& Location) const;
+	float GetSpatialHashListenerRange(const FDigestedSightProperties& PropDigest) const;
+	bool IsInSightSpatialHashRange(const FPerceptionListener& Listener, const FDigestedSightProperties& PropDigest, const FVector& TargetLocation) const;
+	void UpdateSightSpatialHash();
+
+	// Returns true if the entry was added or changed cells
+	template <typename IdType>
+	bool UpdateSpatialHashEntry(TMap<FIntPoint, TArray<IdType>>& Cells, TMap<IdType, FIntPoint>& Lookup, const IdType& Id, const FVector& Location);
+
+	template <typename IdType>
+	void RemoveSpatialHashEntry(TMap<FIntPoint, TArray<IdType>>& Cells, TMap<IdType, FIntPoint>& Lookup, const IdType& Id);
+
+	template <typename FuncType>
+	void ForEachSpatialHashCell(const FVector& Location, float Range, const FuncType& Func) const;
+
 	// Deprecated methods
 public:
 	UE_DEPRECATED(4.25, "Not needed anymore done automatically at the beginning of each update.")
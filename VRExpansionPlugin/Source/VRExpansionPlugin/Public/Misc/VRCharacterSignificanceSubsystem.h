@@ -0,0 +1,115 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "VRCharacterSignificanceSubsystem.generated.h"
+
+class AVRBaseCharacter;
+struct FBPVRCharacterSignificanceTier;
+
+DECLARE_STATS_GROUP(TEXT("VRCharacterSignificance"), STATGROUP_VRCharacterSignificance, STATCAT_Advanced);
+
+// Tracking information for a single remote character, holds the values the character had before we started
+// scaling it so that they can be restored when it becomes significant again or is removed.
+struct VREXPANSIONPLUGIN_API FVRCharacterSignificanceEntry
+{
+	TWeakObjectPtr<AVRBaseCharacter> Character;
+
+	// Tier chosen by distance alone, kept seperate so that hysteresis isn't affected by the off screen demotion
+	int32 DistanceTier;
+
+	// Tier that is currently applied to the character, INDEX_NONE if the original values are in place
+	int32 AppliedTier;
+
+	bool bHasStoredDefaults;
+	float MovementTickInterval;
+	float CameraTickInterval;
+	float LeftControllerTickInterval;
+	float RightControllerTickInterval;
+	float ParentRelativeTickInterval;
+	bool bCameraSmoothReplicatedMotion;
+	bool bLeftSmoothReplicatedMotion;
+	bool bRightSmoothReplicatedMotion;
+	bool bParentRelativeIgnoreRotation;
+	bool bLeftDisableLowLatencyUpdate;
+	bool bRightDisableLowLatencyUpdate;
+
+	FVRCharacterSignificanceEntry() :
+		DistanceTier(INDEX_NONE),
+		AppliedTier(INDEX_NONE),
+		bHasStoredDefaults(false),
+		MovementTickInterval(0.0f),
+		CameraTickInterval(0.0f),
+		LeftControllerTickInterval(0.0f),
+		RightControllerTickInterval(0.0f),
+		ParentRelativeTickInterval(0.0f),
+		bCameraSmoothReplicatedMotion(false),
+		bLeftSmoothReplicatedMotion(false),
+		bRightSmoothReplicatedMotion(false),
+		bParentRelativeIgnoreRotation(false),
+		bLeftDisableLowLatencyUpdate(false),
+		bRightDisableLowLatencyUpdate(false)
+	{}
+
+	FVRCharacterSignificanceEntry(AVRBaseCharacter* InCharacter) :
+		FVRCharacterSignificanceEntry()
+	{
+		Character = InCharacter;
+	}
+
+	void StoreDefaults();
+	void RestoreDefaults();
+	void ApplyTier(const FBPVRCharacterSignificanceTier& Tier);
+};
+
+// Scales down the tick rates and non essential work of remote VR characters based on their distance to the local view
+// and whether they have been rendered recently. Tiers are set in the VRGlobalSettings.
+UCLASS()
+class VREXPANSIONPLUGIN_API UVRCharacterSignificanceSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	UVRCharacterSignificanceSubsystem() :
+		Super()
+	{
+		TimeSinceLastUpdate = 0.0f;
+	}
+
+	// Adds a character to be managed, only simulated proxies are actually scaled
+	void RegisterCharacter(AVRBaseCharacter* InCharacter);
+
+	// Removes a character and restores its original tick settings
+	void UnregisterCharacter(AVRBaseCharacter* InCharacter);
+
+	// Returns the tier currently applied to the character, -1 if it isn't being scaled
+	UFUNCTION(BlueprintPure, Category = "VRCharacterSignificance")
+		int32 GetCharacterSignificanceTier(AVRBaseCharacter* InCharacter) const;
+
+	// Forces a re-evaluation of all characters on the next tick
+	UFUNCTION(BlueprintCallable, Category = "VRCharacterSignificance")
+		void ForceSignificanceUpdate();
+
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject functions
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+	virtual bool IsTickableInEditor() const;
+	virtual bool IsTickableWhenPaused() const override;
+	virtual ETickableTickType GetTickableTickType() const;
+	virtual TStatId GetStatId() const override;
+
+	// End tickable object information
+
+protected:
+
+	void UpdateSignificance();
+
+	TArray<FVRCharacterSignificanceEntry> Characters;
+	float TimeSinceLastUpdate;
+};
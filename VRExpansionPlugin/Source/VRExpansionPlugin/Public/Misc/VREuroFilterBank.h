@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VRBPDatatypes.h"
+
+DECLARE_STATS_GROUP(TEXT("VRFilters"), STATGROUP_VRFilters, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("VREuroFilterBank Filters Run"), STAT_VREuroFilterBankFilters, STATGROUP_VRFilters, VREXPANSIONPLUGIN_API);
+
+// Handle to a filter registered in a FVREuroLowPassFilterBank
+struct VREXPANSIONPLUGIN_API FVREuroFilterHandle
+{
+	int32 Index;
+
+	FVREuroFilterHandle() :
+		Index(INDEX_NONE)
+	{}
+
+	bool IsValid() const
+	{
+		return Index != INDEX_NONE;
+	}
+};
+
+/**
+* Structure of arrays bank of 1 Euro filters that all run in a single SIMD pass, four filters per register.
+* Owners register a filter, push a sample with SetFilterInput, and read GetFilterOutput after RunFilters.
+* The world's bank lives in UVREuroFilterSubsystem which runs it once per frame, so the output trails the input by a frame.
+* Filters that are needed immediately should use FBPEuroLowPassFilter directly, it runs the same step on its xyz lanes.
+*/
+class VREXPANSIONPLUGIN_API FVREuroLowPassFilterBank
+{
+public:
+
+	FVREuroLowPassFilterBank() :
+		NumSlots(0)
+	{}
+
+	FVREuroFilterHandle RegisterFilter(const FBPEuroLowPassFilter& Settings);
+	void UnregisterFilter(FVREuroFilterHandle& Handle);
+
+	void SetFilterSettings(const FVREuroFilterHandle& Handle, const FBPEuroLowPassFilter& Settings);
+
+	// The next sample for this filter will pass through unfiltered
+	void ResetFilter(const FVREuroFilterHandle& Handle);
+
+	void SetFilterInput(const FVREuroFilterHandle& Handle, const FVector& InRawValue);
+
+	// The result of the last pass, a filter that hasn't been run since its reset passes its input straight through
+	FVector GetFilterOutput(const FVREuroFilterHandle& Handle) const;
+
+	// Runs every registered filter on its current input
+	void RunFilters(float DeltaTime);
+
+	int32 GetNumFilters() const
+	{
+		return NumSlots - FreeSlots.Num();
+	}
+
+private:
+
+	typedef TArray<float, TAlignedHeapAllocator<16>> FLaneArray;
+
+	// Per axis lanes, padded to a multiple of four
+	FLaneArray Input[3];
+	FLaneArray RawPrevious[3];
+	FLaneArray DeltaPrevious[3];
+
+	FLaneArray MinCutoff;
+	FLaneArray CutoffSlope;
+	FLaneArray DeltaCutoff;
+
+	// 1.0f when the next sample should pass through
+	FLaneArray FirstTime;
+
+	TArray<int32> FreeSlots;
+	int32 NumSlots;
+
+	bool IsValidHandle(const FVREuroFilterHandle& Handle) const
+	{
+		return Handle.Index >= 0 && Handle.Index < NumSlots;
+	}
+};
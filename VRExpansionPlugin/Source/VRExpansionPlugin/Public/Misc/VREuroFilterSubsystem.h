@@ -0,0 +1,46 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Engine/World.h"
+#include "Misc/VREuroFilterBank.h"
+#include "VREuroFilterSubsystem.generated.h"
+
+// Owns the world's 1 Euro filter bank and runs every registered filter in one pass at the end of the frame.
+// Grip scripts that smooth every frame register here instead of stepping their own filter in the middle of the grip update.
+UCLASS()
+class VREXPANSIONPLUGIN_API UVREuroFilterSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	UVREuroFilterSubsystem() :
+		Super()
+	{
+	}
+
+	FVREuroFilterHandle RegisterFilter(const FBPEuroLowPassFilter& Settings) { return FilterBank.RegisterFilter(Settings); }
+	void UnregisterFilter(FVREuroFilterHandle& Handle) { FilterBank.UnregisterFilter(Handle); }
+
+	FVREuroLowPassFilterBank& GetFilterBank() { return FilterBank; }
+
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject functions
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+	virtual bool IsTickableInEditor() const;
+	virtual bool IsTickableWhenPaused() const override;
+	virtual ETickableTickType GetTickableTickType() const;
+	virtual TStatId GetStatId() const override;
+
+	// End tickable object information
+
+protected:
+
+	FVREuroLowPassFilterBank FilterBank;
+};
@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Engine/World.h"
+#include "VRGripScriptTickSubsystem.generated.h"
+
+class UVRGripScriptBase;
+
+DECLARE_STATS_GROUP(TEXT("VRGripScripts"), STATGROUP_VRGripScripts, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("VRGripScripts Ticking"), STAT_VRGripScriptsTicking, STATGROUP_VRGripScripts, VREXPANSIONPLUGIN_API);
+
+struct VREXPANSIONPLUGIN_API FVRGripScriptTickEntry
+{
+	TWeakObjectPtr<UVRGripScriptBase> Script;
+
+	// Stopped ticking during the tick pass, skipped and removed after it
+	bool bPendingRemoval;
+
+	FVRGripScriptTickEntry(UVRGripScriptBase* InScript) :
+		Script(InScript),
+		bPendingRemoval(false)
+	{}
+};
+
+// All of the ticking grip scripts of a single class, kept together so the same Tick code runs back to back
+struct VREXPANSIONPLUGIN_API FVRGripScriptTickBucket
+{
+	TWeakObjectPtr<UClass> ScriptClass;
+
+	// Per class cycle stat, shows up in the VRGripScripts stat group
+	TStatId StatId;
+
+	TArray<FVRGripScriptTickEntry> Scripts;
+
+	int32 FindScript(const UVRGripScriptBase* Script) const
+	{
+		return Scripts.IndexOfByPredicate([Script](const FVRGripScriptTickEntry& Entry) { return Entry.Script.Get() == Script; });
+	}
+};
+
+// Ticks the grip scripts of a world that currently want to tick, grouped by class.
+// Scripts are only in here between SetTickEnabled(true) and SetTickEnabled(false), so idle scripts cost nothing per frame.
+UCLASS()
+class VREXPANSIONPLUGIN_API UVRGripScriptTickSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	UVRGripScriptTickSubsystem() :
+		Super()
+	{
+		bIsTicking = false;
+		bHasPendingRemovals = false;
+		NumTickingScripts = 0;
+	}
+
+	void RegisterScript(UVRGripScriptBase* Script);
+	void UnregisterScript(UVRGripScriptBase* Script);
+
+	int32 GetNumTickingScripts() const { return NumTickingScripts; }
+
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject functions
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+	virtual bool IsTickableInEditor() const;
+	virtual bool IsTickableWhenPaused() const override;
+	virtual ETickableTickType GetTickableTickType() const;
+	virtual TStatId GetStatId() const override;
+
+	// End tickable object information
+
+protected:
+
+	FVRGripScriptTickBucket& FindOrAddBucket(UClass* ScriptClass);
+
+	TArray<FVRGripScriptTickBucket> Buckets;
+	TMap<TWeakObjectPtr<UClass>, int32> BucketIndices;
+
+	bool bIsTicking;
+
+	// Some entries were flagged for removal during the tick pass
+	bool bHasPendingRemovals;
+
+	int32 NumTickingScripts;
+};
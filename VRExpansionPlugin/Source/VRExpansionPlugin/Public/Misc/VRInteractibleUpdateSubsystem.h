@@ -0,0 +1,161 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "Engine/World.h"
+#include "VRInteractibleUpdateSubsystem.generated.h"
+
+class UVRLeverComponent;
+class UVRDialComponent;
+class UVRSliderComponent;
+class UVRButtonComponent;
+
+DECLARE_STATS_GROUP(TEXT("VRInteractibles"), STATGROUP_VRInteractibles, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("VRInteractibles Active"), STAT_VRInteractiblesActive, STATGROUP_VRInteractibles, VREXPANSIONPLUGIN_API);
+
+// Contiguous list of the currently active interactibles of a single type
+template<class T>
+struct TVRInteractibleUpdateList
+{
+	struct FEntry
+	{
+		TWeakObjectPtr<T> Component;
+
+		// Turned its updates off during the batched pass, skipped and removed after it
+		bool bPendingRemoval;
+
+		FEntry(T* InComponent) :
+			Component(InComponent),
+			bPendingRemoval(false)
+		{}
+	};
+
+	TArray<FEntry> Active;
+	bool bIsUpdating;
+	bool bHasPendingRemovals;
+
+	TVRInteractibleUpdateList() :
+		bIsUpdating(false),
+		bHasPendingRemovals(false)
+	{}
+
+	void SetActive(T* Component, bool bActive)
+	{
+		const int32 EntryIndex = Active.IndexOfByPredicate([Component](const FEntry& Entry) { return Entry.Component.Get() == Component; });
+
+		if (bActive)
+		{
+			if (EntryIndex != INDEX_NONE)
+			{
+				Active[EntryIndex].bPendingRemoval = false;
+			}
+			else
+			{
+				Active.Emplace(Component);
+			}
+		}
+		else if (EntryIndex != INDEX_NONE)
+		{
+			if (bIsUpdating)
+			{
+				// Can't shuffle the list under the update loop, flag it and clean up after
+				Active[EntryIndex].bPendingRemoval = true;
+				bHasPendingRemovals = true;
+			}
+			else
+			{
+				Active.RemoveAtSwap(EntryIndex, 1, false);
+			}
+		}
+	}
+
+	void Update(float DeltaTime)
+	{
+		bIsUpdating = true;
+		for (int32 Index = 0; Index < Active.Num(); ++Index)
+		{
+			T* Component = Active[Index].Component.Get();
+			if (Component && Component->IsRegistered() && !Active[Index].bPendingRemoval)
+			{
+				Component->TickInteractible(DeltaTime);
+			}
+		}
+		bIsUpdating = false;
+
+		// Clear out anything that turned off, was destroyed or was unregistered while active
+		const bool bRemoveFlagged = bHasPendingRemovals;
+		bHasPendingRemovals = false;
+
+		Active.RemoveAllSwap([bRemoveFlagged](const FEntry& Entry)
+		{
+			return (bRemoveFlagged && Entry.bPendingRemoval) || !Entry.Component.IsValid() || !Entry.Component->IsRegistered();
+		}, false);
+	}
+};
+
+// Updates the active levers, dials, sliders and buttons of a world in one batched pass instead of a component tick each.
+// Components only sit in the lists while they are held, lerping or carrying momentum. Enabled by bUseBatchedInteractibleUpdates in the VRGlobalSettings.
+//
+// Being a tickable object the pass runs after TG_PostPhysics (the components tick in TG_DuringPhysics on their own), still before rendering so
+// the interactibles land on screen the same frame. Anything ticking in TG_PostPhysics that reads their values will see last frames state.
+//
+// The VRMountComponent isn't batched, its TickComponent doesn't do anything and all of its work runs from TickGrip on the holding controller.
+UCLASS()
+class VREXPANSIONPLUGIN_API UVRInteractibleUpdateSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	UVRInteractibleUpdateSubsystem() :
+		Super()
+	{
+	}
+
+	// Turns the per frame update of an interactible on or off, routes it through the subsystem when batching is enabled
+	// and through the components own tick otherwise.
+	template<class T>
+	static void SetUpdateEnabled(T* Component, bool bEnabled)
+	{
+		UWorld* World = Component->GetWorld();
+		UVRInteractibleUpdateSubsystem* Subsystem = (World && World->IsGameWorld() && ShouldBatchUpdates()) ? World->GetSubsystem<UVRInteractibleUpdateSubsystem>() : nullptr;
+
+		if (!Subsystem)
+		{
+			Component->SetComponentTickEnabled(bEnabled);
+			return;
+		}
+
+		Component->SetComponentTickEnabled(false);
+		Subsystem->GetUpdateList(Component).SetActive(Component, bEnabled);
+	}
+
+	static bool ShouldBatchUpdates();
+
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject functions
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+	virtual bool IsTickableInEditor() const;
+	virtual bool IsTickableWhenPaused() const override;
+	virtual ETickableTickType GetTickableTickType() const;
+	virtual TStatId GetStatId() const override;
+
+	// End tickable object information
+
+protected:
+
+	TVRInteractibleUpdateList<UVRLeverComponent>& GetUpdateList(UVRLeverComponent*) { return Levers; }
+	TVRInteractibleUpdateList<UVRDialComponent>& GetUpdateList(UVRDialComponent*) { return Dials; }
+	TVRInteractibleUpdateList<UVRSliderComponent>& GetUpdateList(UVRSliderComponent*) { return Sliders; }
+	TVRInteractibleUpdateList<UVRButtonComponent>& GetUpdateList(UVRButtonComponent*) { return Buttons; }
+
+	TVRInteractibleUpdateList<UVRLeverComponent> Levers;
+	TVRInteractibleUpdateList<UVRDialComponent> Dials;
+	TVRInteractibleUpdateList<UVRSliderComponent> Sliders;
+	TVRInteractibleUpdateList<UVRButtonComponent> Buttons;
+};
@@ -22,36 +22,25 @@ enum class EBPVRConsoleDrawType : uint8
 };
 
 
-/**
-* A single log message for the output log, holding a message and
-* a style, for color and bolding of the message.
-*/
-struct FVRLogMessage
+// Info for a single line stored in the output log ring buffer, the characters live in the shared arena
+struct FVRLogLineInfo
 {
-	TSharedRef<FString> Message;
+	// Index of the line currently held in this slot, -1 while it is being written
+	volatile int64 Sequence;
+	int32 Length;
 	ELogVerbosity::Type Verbosity;
-	FName Category;
-	FName Style;
-
-	FVRLogMessage(const TSharedRef<FString>& NewMessage, FName NewCategory, FName NewStyle = NAME_None)
-		: Message(NewMessage)
-		, Verbosity(ELogVerbosity::Log)
-		, Category(NewCategory)
-		, Style(NewStyle)
-	{
-	}
 
-	FVRLogMessage(const TSharedRef<FString>& NewMessage, ELogVerbosity::Type NewVerbosity, FName NewCategory, FName NewStyle = NAME_None)
-		: Message(NewMessage)
-		, Verbosity(NewVerbosity)
-		, Category(NewCategory)
-		, Style(NewStyle)
-	{
-	}
+	FVRLogLineInfo() :
+		Sequence(-1),
+		Length(0),
+		Verbosity(ELogVerbosity::Log)
+	{}
 };
 
 // Custom Log output history class to hold the VR logs.
 /** This class is to capture all log output even if the log window is closed */
+/** Lines are stored pre-wrapped in a fixed capacity ring buffer with a single character arena, any thread can write */
+/** to it without locking and the draw reads the newest lines in place instead of copying the history */
 class FVROutputLogHistory : public FOutputDevice
 {
 public:
@@ -65,130 +54,262 @@ public:
 		MaxLineLength = 130;
 		bIsDirty = false;
 		MaxStoredMessages = 1000;
-		GLog->AddOutputDevice(this);
-		GLog->SerializeBacklog(this);
+		NextLineIndex = 0;
+		bRegistered = false;
 	}
 
 	~FVROutputLogHistory()
 	{
 		// At shutdown, GLog may already be null
-		if (GLog != NULL)
+		if (bRegistered && GLog != NULL)
 		{
 			GLog->RemoveOutputDevice(this);
 		}
 	}
 
-	/** Gets all captured messages */
-	const TArray< TSharedPtr<FVRLogMessage> >& GetMessages() const
+	// Allocates the ring buffer and starts capturing the log, the backlog is pulled in as well
+	void Initialize(int32 InMaxStoredMessages, int32 InMaxLineLength)
+	{
+		if (bRegistered && GLog != NULL)
+		{
+			GLog->RemoveOutputDevice(this);
+			bRegistered = false;
+		}
+
+		MaxLineLength = FMath::Max(InMaxLineLength, 1);
+
+		// Every slot reserves a full line in the arena, so cap the line count by the memory that reserves
+		const int32 MaxLinesInArena = FMath::Max(MaxArenaBytes / (MaxLineLength * (int32)sizeof(TCHAR)), 1);
+		MaxStoredMessages = FMath::Clamp(InMaxStoredMessages, 1, MaxLinesInArena);
+
+		// The buffer is only resized while no one is writing to it
+		LineInfos.Reset();
+		LineInfos.SetNum(MaxStoredMessages);
+		LineArena.Reset();
+		LineArena.SetNumZeroed(MaxStoredMessages * MaxLineLength);
+		NextLineIndex = 0;
+
+		if (GLog != NULL)
+		{
+			GLog->AddOutputDevice(this);
+			GLog->SerializeBacklog(this);
+			bRegistered = true;
+		}
+	}
+
+	/** Gets the index of the newest line written, -1 if none */
+	int64 GetNewestLineIndex() const
+	{
+		return FPlatformAtomics::AtomicRead(&NextLineIndex) - 1;
+	}
+
+	/** Gets the number of lines currently held */
+	int32 GetNumLines() const
 	{
-		return Messages;
+		return (int32)FMath::Min<int64>(FPlatformAtomics::AtomicRead(&NextLineIndex), LineInfos.Num());
 	}
 
+	/**
+	* Visits the stored lines from newest to oldest after skipping SkipLines, stops when Func returns false.
+	* Lines that are being overwritten while read are skipped, Func gets (int64 LineIndex, const TCHAR* Line, int32 Length, ELogVerbosity::Type Verbosity)
+	*/
+	template<typename FuncType>
+	void ForEachLineNewestFirst(int32 SkipLines, const FuncType& Func) const
+	{
+		const int64 Capacity = LineInfos.Num();
+		if (Capacity <= 0)
+			return;
+
+		TCHAR LineBuffer[MaxLineBufferLength + 1];
+		const int64 NewestLine = FPlatformAtomics::AtomicRead(&NextLineIndex) - 1;
+		const int64 OldestLine = FMath::Max<int64>(0, NewestLine - Capacity + 1);
+
+		for (int64 LineIndex = NewestLine - SkipLines; LineIndex >= OldestLine; --LineIndex)
+		{
+			const int32 Slot = (int32)(LineIndex % Capacity);
+			const FVRLogLineInfo& LineInfo = LineInfos[Slot];
+
+			if (FPlatformAtomics::AtomicRead(&LineInfo.Sequence) != LineIndex)
+				continue;
+
+			const int32 Length = FMath::Min(LineInfo.Length, MaxLineBufferLength);
+			const ELogVerbosity::Type Verbosity = LineInfo.Verbosity;
+			FMemory::Memcpy(LineBuffer, &LineArena[Slot * MaxLineLength], Length * sizeof(TCHAR));
+			LineBuffer[Length] = TEXT('\0');
+
+			// Writer lapped us while copying, the line is torn
+			FPlatformMisc::MemoryBarrier();
+			if (FPlatformAtomics::AtomicRead(&LineInfo.Sequence) != LineIndex)
+				continue;
+
+			if (!Func(LineIndex, LineBuffer, Length, Verbosity))
+				break;
+		}
+	}
+
+	// MaxLineLength is clamped to this by the component
+	static const int32 MaxLineBufferLength = 1000;
+
+	// Upper bound on the character arena, MaxStoredMessages is lowered to fit in it
+	static const int32 MaxArenaBytes = 8 * 1024 * 1024;
+
 protected:
 
 	virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const class FName& Category) override
 	{
 		// Capture all incoming messages and store them in history
-		CreateLogMessages(V, Verbosity, Category, Messages);
+		CreateLogMessages(V, Verbosity, Category);
 	}
 
-	bool CreateLogMessages(const TCHAR* V, ELogVerbosity::Type Verbosity, const class FName& Category, TArray< TSharedPtr<FVRLogMessage> >& OutMessages)
+	bool CreateLogMessages(const TCHAR* V, ELogVerbosity::Type Verbosity, const class FName& Category)
 	{
-		if (Verbosity == ELogVerbosity::SetColor)
+		if (Verbosity == ELogVerbosity::SetColor || LineInfos.Num() == 0 || V == nullptr)
 		{
 			// Skip Color Events
 			return false;
 		}
-		else
-		{
-			FName Style;
-			if (Category == NAME_Cmd)
-			{
-				Style = FName(TEXT("Log.Command"));
-			}
-			else if (Verbosity == ELogVerbosity::Error)
-			{
-				Style = FName(TEXT("Log.Error"));
-			}
-			else if (Verbosity == ELogVerbosity::Warning)
-			{
-				Style = FName(TEXT("Log.Warning"));
-			}
-			else
-			{
-				Style = FName(TEXT("Log.Normal"));
-			}
 
-			// Forget timestamps, I don't care about them and we have limited texture space to draw too
-			// Determine how to format timestamps
-			static ELogTimes::Type LogTimestampMode = ELogTimes::None;
-			/*if (UObjectInitialized() && !GExitPurge)
-			{
-			// Logging can happen very late during shutdown, even after the UObject system has been torn down, hence the init check above
-			LogTimestampMode = GetDefault<UEditorStyleSettings>()->LogTimestampMode;
-			}*/
+		const int32 MaxPrefixLen = MaxLineLength / 2;
 
-			const int32 OldNumMessages = OutMessages.Num();
+		bool bAddedLines = false;
+		bool bIsFirstLineInMessage = true;
+		const TCHAR* Current = V;
 
-			// handle multiline strings by breaking them apart by line
-			TArray<FTextRange> LineRanges;
-			FString CurrentLogDump = V;
-			FTextRange::CalculateLineRangesFromString(CurrentLogDump, LineRanges);
+		// Handle multiline strings by breaking them apart by line, hard-wrapping lines to avoid them being too long
+		while (*Current)
+		{
+			const TCHAR* LineEnd = Current;
+			int32 LineLen = 0;
+			while (*LineEnd && *LineEnd != TEXT('\n') && *LineEnd != TEXT('\r'))
+			{
+				LineLen += (*LineEnd == TEXT('\t')) ? 4 : 1;
+				++LineEnd;
+			}
 
-			bool bIsFirstLineInMessage = true;
-			for (const FTextRange& LineRange : LineRanges)
+			if (LineLen > 0)
 			{
-				if (!LineRange.IsEmpty())
+				const TCHAR* Read = Current;
+				int32 PendingSpaces = 0;
+				while (Read < LineEnd || PendingSpaces > 0)
 				{
-					FString Line = CurrentLogDump.Mid(LineRange.BeginIndex, LineRange.Len());
-					Line = Line.ConvertTabsToSpaces(4);
+					TCHAR* Write = nullptr;
+					int64 LineIndex = 0;
+					FVRLogLineInfo& LineInfo = BeginLine(LineIndex, Write);
+					int32 WriteLen = 0;
 
-					// Hard-wrap lines to avoid them being too long
-					/*static const */int32 HardWrapLen = MaxLineLength;
-					for (int32 CurrentStartIndex = 0; CurrentStartIndex < Line.Len();)
+					if (bIsFirstLineInMessage)
 					{
-						int32 HardWrapLineLen = 0;
-						if (bIsFirstLineInMessage)
-						{
-							FString MessagePrefix = FOutputDeviceHelper::FormatLogLine(Verbosity, Category, nullptr, LogTimestampMode);
-
-							HardWrapLineLen = FMath::Min(HardWrapLen - MessagePrefix.Len(), Line.Len() - CurrentStartIndex);
-							FString HardWrapLine = Line.Mid(CurrentStartIndex, HardWrapLineLen);
+						WriteLen = WriteMessagePrefix(Write, MaxPrefixLen, Verbosity, Category);
+						bIsFirstLineInMessage = false;
+					}
 
-							OutMessages.Add(MakeShareable(new FVRLogMessage(MakeShareable(new FString(MessagePrefix + HardWrapLine)), Verbosity, Category, Style)));
+					while (WriteLen < MaxLineLength && (Read < LineEnd || PendingSpaces > 0))
+					{
+						if (PendingSpaces > 0)
+						{
+							Write[WriteLen++] = TEXT(' ');
+							--PendingSpaces;
+						}
+						else if (*Read == TEXT('\t'))
+						{
+							PendingSpaces = 4;
+							++Read;
 						}
 						else
 						{
-							HardWrapLineLen = FMath::Min(HardWrapLen, Line.Len() - CurrentStartIndex);
-							FString HardWrapLine = Line.Mid(CurrentStartIndex, HardWrapLineLen);
-
-							OutMessages.Add(MakeShareable(new FVRLogMessage(MakeShareable(new FString(MoveTemp(HardWrapLine))), Verbosity, Category, Style)));
+							Write[WriteLen++] = *Read++;
 						}
-
-						bIsFirstLineInMessage = false;
-						CurrentStartIndex += HardWrapLineLen;
 					}
+
+					EndLine(LineInfo, LineIndex, WriteLen, Verbosity);
+					bAddedLines = true;
 				}
 			}
 
-			int numMessages = OutMessages.Num();
-			if (numMessages > MaxStoredMessages)
+			// Treat \r\n as a single break
+			if (*LineEnd == TEXT('\r') && *(LineEnd + 1) == TEXT('\n'))
 			{
-				OutMessages.RemoveAt(0, numMessages - MaxStoredMessages, true);
+				++LineEnd;
 			}
-			if (OldNumMessages != numMessages)
-				bIsDirty = true;
 
-			return OldNumMessages != numMessages;//OutMessages.Num();
+			Current = *LineEnd ? LineEnd + 1 : LineEnd;
 		}
+
+		if (bAddedLines)
+			bIsDirty = true;
+
+		return bAddedLines;
+	}
+
+	// Writes the same prefix FOutputDeviceHelper::FormatLogLine would (minus timestamps, we have limited texture space to draw too)
+	// straight into the line so that logging doesn't allocate, returns the number of characters written
+	static int32 WriteMessagePrefix(TCHAR* Write, int32 MaxLen, ELogVerbosity::Type Verbosity, const class FName& Category)
+	{
+		int32 Len = 0;
+		auto AppendText = [Write, MaxLen, &Len](const TCHAR* Text)
+		{
+			while (*Text && Len < MaxLen)
+			{
+				Write[Len++] = *Text++;
+			}
+		};
+
+		if (GPrintLogCategory && Category != NAME_None)
+		{
+			TCHAR CategoryName[NAME_SIZE];
+			Category.ToString(CategoryName, NAME_SIZE);
+			AppendText(CategoryName);
+			AppendText(TEXT(": "));
+		}
+
+		if (GPrintLogVerbosity && Verbosity != ELogVerbosity::Log)
+		{
+			AppendText(ToString(Verbosity));
+			AppendText(TEXT(": "));
+		}
+
+		return Len;
+	}
+
+	// Claims the next slot in the ring, the line is invisible to readers until EndLine is called
+	FVRLogLineInfo& BeginLine(int64& OutLineIndex, TCHAR*& OutLineStart)
+	{
+		OutLineIndex = FPlatformAtomics::InterlockedIncrement(&NextLineIndex) - 1;
+		const int32 Slot = (int32)(OutLineIndex % LineInfos.Num());
+
+		FVRLogLineInfo& LineInfo = LineInfos[Slot];
+		FPlatformAtomics::AtomicStore(&LineInfo.Sequence, (int64)-1);
+
+		OutLineStart = &LineArena[Slot * MaxLineLength];
+		return LineInfo;
+	}
+
+	void EndLine(FVRLogLineInfo& LineInfo, int64 LineIndex, int32 Length, ELogVerbosity::Type Verbosity)
+	{
+		LineInfo.Length = Length;
+		LineInfo.Verbosity = Verbosity;
+		FPlatformMisc::MemoryBarrier();
+		FPlatformAtomics::AtomicStore(&LineInfo.Sequence, LineIndex);
 	}
 
 private:
 
-	/** All log messages since this module has been started */
-	TArray< TSharedPtr<FVRLogMessage> > Messages;
+	/** Ring buffer of the last MaxStoredMessages lines, each line has MaxLineLength characters reserved in the arena */
+	TArray<FVRLogLineInfo> LineInfos;
+	TArray<TCHAR> LineArena;
+
+	/** Total number of lines ever written, the newest line is NextLineIndex - 1 */
+	volatile int64 NextLineIndex;
+	bool bRegistered;
 };
 
+// A laid out output log line, kept between draws so lines that are still visible don't get rebuilt
+struct FVRCachedLogLine
+{
+	FText Text;
+	FLinearColor Color;
+};
+
 /**
 * This class taps into the output log and console and renders them to textures so they can be viewed in levels.
 * Generally used for debugging and testing in VR, also allows sending input to the console.
@@ -209,13 +330,13 @@ public:
 	virtual void PostInitProperties() override
 	{
 		Super::PostInitProperties();
-		OutputLogHistory.MaxStoredMessages = FMath::Clamp(MaxStoredMessages, 100, 100000);
-		OutputLogHistory.MaxLineLength = FMath::Clamp(MaxLineLength, 50, 1000);
+		OutputLogHistory.Initialize(FMath::Clamp(MaxStoredMessages, 100, 100000), FMath::Clamp(MaxLineLength, 50, FVROutputLogHistory::MaxLineBufferLength));
 	}
 
 	UPROPERTY(BlueprintReadWrite,EditAnywhere, Category = "VRLogComponent|Console")
 		int32 MaxLineLength;
 
+	// Lowered if needed so that the stored lines fit in FVROutputLogHistory::MaxArenaBytes
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VRLogComponent|Console")
 		int32 MaxStoredMessages;
 
@@ -239,4 +360,15 @@ public:
 	void DrawConsole(bool bLowerHalfOnly, UCanvas* Canvas);
 	void DrawOutputLog(bool bUpperHalfOnly, UCanvas* Canvas, float ScrollOffset);
 
+private:
+
+	// Lines drawn last output log draw keyed by their line index in the log history
+	TMap<int64, FVRCachedLogLine> CachedLogLines;
+	TMap<int64, FVRCachedLogLine> CachedLogLinesScratch;
+
+	// State of the last output log draw, if nothing changed the render target already holds the correct contents
+	TWeakObjectPtr<UTextureRenderTarget2D> LastOutputLogTexture;
+	int64 LastOutputLogNewestLine;
+	int32 LastOutputLogScrollPos;
+
 };
\ No newline at end of file
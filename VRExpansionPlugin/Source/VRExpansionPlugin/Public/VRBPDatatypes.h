@@ -152,6 +152,34 @@ public:
 };
 
 
+namespace VREuroFilter
+{
+	// One 1 Euro filter step on four independent lanes, shared by FBPEuroLowPassFilter (xyz lanes) and FVREuroLowPassFilterBank (four filters per lane)
+	// Updates RawPrev / DeltaPrev in place and returns the filtered value, the caller handles the first sample.
+	FORCEINLINE VectorRegister FilterStep(const VectorRegister& Raw, VectorRegister& RawPrev, VectorRegister& DeltaPrev, const VectorRegister& MinCutoff, const VectorRegister& CutoffSlope, const VectorRegister& DeltaCutoff, const VectorRegister& DeltaTime)
+	{
+		const VectorRegister One = VectorOne();
+		const VectorRegister TwoPiDeltaTime = VectorMultiply(DeltaTime, VectorSetFloat1(2.0f * PI));
+
+		// alpha = 1 / (1 + tau / dt) with tau = 1 / (2 * PI * cutoff), written as x / (x + 1) with x = 2 * PI * cutoff * dt
+		const VectorRegister DeltaX = VectorMultiply(DeltaCutoff, TwoPiDeltaTime);
+		const VectorRegister DeltaAlpha = VectorDivide(DeltaX, VectorAdd(DeltaX, One));
+
+		// Filter the delta to get the estimated
+		const VectorRegister Delta = VectorMultiply(VectorSubtract(Raw, RawPrev), DeltaTime);
+		DeltaPrev = VectorMultiplyAdd(DeltaAlpha, VectorSubtract(Delta, DeltaPrev), DeltaPrev);
+
+		// Use the estimated to calculate the cutoff
+		const VectorRegister Cutoff = VectorMultiplyAdd(CutoffSlope, VectorAbs(DeltaPrev), MinCutoff);
+		const VectorRegister X = VectorMultiply(Cutoff, TwoPiDeltaTime);
+		const VectorRegister Alpha = VectorDivide(X, VectorAdd(X, One));
+
+		// Filter passed value
+		RawPrev = VectorMultiplyAdd(Alpha, VectorSubtract(Raw, RawPrev), RawPrev);
+		return RawPrev;
+	}
+}
+
 /************************************************************************/
 /* 1 Euro filter smoothing algorithm									*/
 /* http://cristal.univ-lille.fr/~casiez/1euro/							*/
@@ -196,10 +224,6 @@ public:
 
 private:
 
-	const FVector CalculateCutoff(const FVector& InValue);
-	const FVector CalculateAlpha(const FVector& InCutoff, const double InDeltaTime) const;
-	const float CalculateAlpha(const float InCutoff, const double InDeltaTime) const;
-
 	FBasicLowPassFilter RawFilter;
 	FBasicLowPassFilter DeltaFilter;
 
@@ -230,7 +254,11 @@ public:
 	/** Default constructor */
 	FBPLowPassPeakFilter() :
 		VelocitySamples(30),
-		VelocitySampleLogCounter(0)
+		VelocitySampleLogCounter(0),
+		NumStoredSamples(0),
+		PeakQueueHead(0),
+		PeakQueueNum(0),
+		VelocitySampleSum(FVector::ZeroVector)
 	{}
 
 	// This is the number of samples to keep active
@@ -242,9 +270,30 @@ public:
 	
 	int32 VelocitySampleLogCounter;
 
+	// Cached SizeSquared of each entry in the sample log
+	TArray<float> VelocitySampleSizesSq;
+
+	// Number of samples written since the last reset, capped at VelocitySamples
+	int32 NumStoredSamples;
+
+	// Monotonic queue (ring over VelocitySamples) of sample log indices with decreasing magnitude, the head is the current peak
+	TArray<int32> PeakQueue;
+	int32 PeakQueueHead;
+	int32 PeakQueueNum;
+
+	// Running sum of the stored samples for the windowed average
+	FVector VelocitySampleSum;
+
 	void Reset()
 	{
 		VelocitySampleLog.Reset(VelocitySamples);
+		VelocitySampleSizesSq.Reset(VelocitySamples);
+		PeakQueue.Reset(VelocitySamples);
+		VelocitySampleLogCounter = 0;
+		NumStoredSamples = 0;
+		PeakQueueHead = 0;
+		PeakQueueNum = 0;
+		VelocitySampleSum = FVector::ZeroVector;
 	}
 
 	void AddSample(FVector NewSample)
@@ -252,22 +301,87 @@ public:
 		if (VelocitySamples <= 0)
 			return;
 
-		if (VelocitySampleLog.Num() != VelocitySamples)
+		if (VelocitySampleLog.Num() != VelocitySamples || PeakQueue.Num() != VelocitySamples)
 		{
-			VelocitySampleLog.Reset(VelocitySamples);
-			VelocitySampleLog.AddZeroed(VelocitySamples);
-			VelocitySampleLogCounter = 0;
+			RebuildFromSampleLog();
 		}
 
-		VelocitySampleLog[VelocitySampleLogCounter] = NewSample;
+		const int32 Slot = VelocitySampleLogCounter;
+
+		// The sample we are overwriting is the oldest in the window, if it is still queued it is at the head
+		if (PeakQueueNum > 0 && PeakQueue[PeakQueueHead] == Slot)
+		{
+			PeakQueueHead = (PeakQueueHead + 1) % VelocitySamples;
+			--PeakQueueNum;
+		}
+
+		VelocitySampleSum += NewSample - VelocitySampleLog[Slot];
+		VelocitySampleLog[Slot] = NewSample;
+
+		const float NewSizeSq = NewSample.SizeSquared();
+		VelocitySampleSizesSq[Slot] = NewSizeSq;
+
+		// Older samples that are not larger than this one can never be the peak again
+		while (PeakQueueNum > 0 && VelocitySampleSizesSq[PeakQueue[(PeakQueueHead + PeakQueueNum - 1) % VelocitySamples]] <= NewSizeSq)
+		{
+			--PeakQueueNum;
+		}
+
+		PeakQueue[(PeakQueueHead + PeakQueueNum) % VelocitySamples] = Slot;
+		++PeakQueueNum;
+
+		if (NumStoredSamples < VelocitySamples)
+			++NumStoredSamples;
+
 		++VelocitySampleLogCounter;
 
 		if (VelocitySampleLogCounter >= VelocitySamples)
+		{
 			VelocitySampleLogCounter = 0;
+
+			// Re-sum once per wrap so float error in the running sum can't build up
+			VelocitySampleSum = FVector::ZeroVector;
+			for (const FVector& Sample : VelocitySampleLog)
+			{
+				VelocitySampleSum += Sample;
+			}
+		}
+	}
+
+	// Sizes the buffers to VelocitySamples and replays whatever was already in the log (defaults, blueprint edits
+	// or a changed sample count) oldest first, so the queue, sum and counters match it instead of being thrown away
+	void RebuildFromSampleLog()
+	{
+		const int32 OldNum = VelocitySampleLog.Num();
+		const int32 OldestSlot = (VelocitySampleLogCounter >= 0 && VelocitySampleLogCounter < OldNum) ? VelocitySampleLogCounter : 0;
+
+		TArray<FVector> OldSamples;
+		OldSamples.Reserve(OldNum);
+		for (int32 i = 0; i < OldNum; ++i)
+		{
+			OldSamples.Add(VelocitySampleLog[(OldestSlot + i) % OldNum]);
+		}
+
+		Reset();
+		VelocitySampleLog.AddZeroed(VelocitySamples);
+		VelocitySampleSizesSq.AddZeroed(VelocitySamples);
+		PeakQueue.AddZeroed(VelocitySamples);
+
+		// Only the newest VelocitySamples fit in the window
+		for (int32 i = FMath::Max(0, OldNum - VelocitySamples); i < OldNum; ++i)
+		{
+			AddSample(OldSamples[i]);
+		}
 	}
 
 	FVector GetPeak() const
 	{
+		if (PeakQueueNum > 0 && PeakQueue.Num() == VelocitySampleLog.Num())
+		{
+			return VelocitySampleLog[PeakQueue[PeakQueueHead]];
+		}
+
+		// Log was filled without AddSample (defaults / blueprint edits), scan it
 		FVector MaxValue = FVector::ZeroVector;
 		float ValueSizeSq = 0.f;
 		float CurSizeSq = 0.f;
@@ -284,6 +398,26 @@ public:
 
 		return MaxValue;
 	}
+
+	// Average of the samples currently in the window
+	FVector GetAverage() const
+	{
+		if (NumStoredSamples > 0 && PeakQueue.Num() == VelocitySampleLog.Num())
+		{
+			return VelocitySampleSum / (float)NumStoredSamples;
+		}
+
+		if (VelocitySampleLog.Num() < 1)
+			return FVector::ZeroVector;
+
+		FVector Sum = FVector::ZeroVector;
+		for (const FVector& Sample : VelocitySampleLog)
+		{
+			Sum += Sample;
+		}
+
+		return Sum / (float)VelocitySampleLog.Num();
+	}
 };
 
 // Some static vars so we don't have to keep calculating these for our Smallest Three compression
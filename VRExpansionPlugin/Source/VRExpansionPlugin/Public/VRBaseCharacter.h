@@ -249,6 +249,9 @@ public:
 	virtual void CacheInitialMeshOffset(FVector MeshRelativeLocation, FRotator MeshRelativeRotation) override;
 	virtual void PostInitializeComponents() override;
 
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void PossessedBy(AController* NewController);
 	virtual void OnRep_Controller() override;
 	virtual void OnRep_PlayerState() override;
@@ -44,6 +44,12 @@ public:
 	virtual void SetUpdatedComponent(USceneComponent* NewUpdatedComponent);
 
 	virtual void PerformMovement(float DeltaSeconds) override;
+
+protected:
+	// Overriding to count sweeping moves for the VRMovement stats group
+	virtual bool MoveUpdatedComponentImpl(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit = NULL, ETeleportType Teleport = ETeleportType::None) override;
+public:
+
 	//virtual void ReplicateMoveToServer(float DeltaTime, const FVector& NewAcceleration) override;
 
 	// Overriding this to run the seated logic
@@ -259,6 +265,29 @@ public:
 	/** Update mesh location based on interpolated values. */
 	void SmoothClientPosition_UpdateVRVisuals();
 
+	// If true simulated proxies run a single correction timeline on the NetSmoother (which the camera, controllers and PRC are parented to)
+	// with a blend time that shortens as the proxy moves faster, and finish smoothing early once the remaining error is too small to see.
+	// Only used with Linear or Exponential network smoothing.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Smoothing")
+		bool bUseUnifiedVRProxySmoothing;
+
+	// Once the remaining smoothing error is smaller than this in cm the smoothing is finished early, avoiding transform and bone updates
+	// for the entire attached hierarchy while the error is not visible.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Smoothing", meta = (ClampMin = "0.0", UIMin = "0"))
+		float UnifiedSmoothingVisualThreshold;
+
+	// Proxy speed in cm/s at which the smoothing blend time reaches UnifiedSmoothingMinTimeScale
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Smoothing", meta = (ClampMin = "1.0", UIMin = "1"))
+		float UnifiedSmoothingReferenceSpeed;
+
+	// Scaler on the smoothing blend time at or above UnifiedSmoothingReferenceSpeed, stationary proxies use the full blend time
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Smoothing", meta = (ClampMin = "0.05", UIMin = "0.05", ClampMax = "1.0", UIMax = "1.0"))
+		float UnifiedSmoothingMinTimeScale;
+
+	// Scaler for the smoothing blend times from the current proxy velocity, 1.0 when unified smoothing is off.
+	// Applied to the blend times locally, the prediction datas configured times are never overwritten.
+	float GetUnifiedSmoothingTimeScale() const;
+
 	// Added in 4.16
 	///* Allow custom handling when character hits a wall while swimming. */
 	//virtual void HandleSwimmingWallHit(const FHitResult& Hit, float DeltaTime);
@@ -322,6 +351,35 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Climbing")
 		float VRClimbingMaxReleaseVelocitySize;
 
+	// If true will gather the blocking geometry around the capsule and climbing hands when climbing starts and test climbing moves
+	// against that local set first, the world sweeps / floor checks are only ran when the local set can't prove the move is clear.
+	// Objects that enter the gathered area after it was built are not seen until the next refresh, so leave this off if
+	// you climb around fast moving dynamic objects.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Climbing|Broadphase")
+		bool bUseClimbingBroadphase;
+
+	// Distance to extend the gathered area past the capsule and hands when building the climbing broadphase
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Climbing|Broadphase", meta = (ClampMin = "0.0", UIMin = "0"))
+		float ClimbingBroadphaseExtent;
+
+	// Seconds before the climbing broadphase is re-gathered, 0 will only re-gather when the capsule leaves the gathered area
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMovement|Climbing|Broadphase", meta = (ClampMin = "0.0", UIMin = "0"))
+		float ClimbingBroadphaseRefreshInterval;
+
+	// Gathers the local climbing set around the capsule and the hands that are holding the character up
+	void BuildClimbingBroadphase();
+
+	// Drops the local climbing set, it will be re-gathered on the next climbing move
+	void ClearClimbingBroadphase();
+
+	// Returns true if the box is fully within the gathered area and touches none of the gathered components
+	// False means the local set is inconclusive and a world query needs to be ran
+	bool IsClimbingBroadphaseClear(const FBox& TestBox) const;
+
+	FBox ClimbingBroadphaseBounds;
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> ClimbingBroadphaseComponents;
+	float ClimbingBroadphaseBuildTime;
+
 	/* Custom distance that is required before accepting a walking stepup
 	*  This is to help promote stepping up, engine default is 0.15f, generally you want it lower than that
 	*  Do NOT set to larger than capsule radius!
@@ -303,14 +303,19 @@ public:
 class VREXPANSIONPLUGIN_API FNetworkPredictionData_Client_VRCharacter : public FNetworkPredictionData_Client_Character
 {
 public:
+	// Moves to pre-allocate into the free pool, enough to cover a full round trip at high refresh rates
+	static const int32 PrewarmedSavedMoveCount = 48;
+
 	FNetworkPredictionData_Client_VRCharacter(const UCharacterMovementComponent& ClientMovement)
 		: FNetworkPredictionData_Client_Character(ClientMovement)
 	{
-
+		VRPrewarmClientSavedMoves<FSavedMove_VRCharacter>(*this, PrewarmedSavedMoveCount);
 	}
 
 	FSavedMovePtr AllocateNewMove()
 	{
+		// Only hit when the free pool is exhausted
+		INC_DWORD_STAT(STAT_VRSavedMoveAllocations);
 		return FSavedMovePtr(new FSavedMove_VRCharacter());
 	}
 };
@@ -253,6 +253,13 @@ public:
 		return TargetPeakFilter.GetPeak();
 	}
 
+	/** Gets the average value of the samples currently in the Peak Low Pass Filter */
+	UFUNCTION(BlueprintCallable, Category = "LowPassFilter_Peak")
+		static FVector GetAverage_PeakLowPassFilter(UPARAM(ref) FBPLowPassPeakFilter& TargetPeakFilter)
+	{
+		return TargetPeakFilter.GetAverage();
+	}
+
 
 	/** Resets a Euro Low Pass Filter so that the first time it is used again it is clean */
 	UFUNCTION(BlueprintCallable, Category = "EuroLowPassFilter")
@@ -109,6 +109,57 @@ public:
 	}
 };
 
+// Per tier settings for the VR character significance subsystem, tiers are checked in order and the first one
+// that the remote character is within range of is used.
+USTRUCT(BlueprintType, Category = "VRCharacterSignificance")
+struct VREXPANSIONPLUGIN_API FBPVRCharacterSignificanceTier
+{
+	GENERATED_BODY()
+public:
+
+	// Distance from the local view that a remote character must be within to use this tier
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterSignificance", meta = (ClampMin = "0.0", UIMin = "0"))
+		float MaxDistance;
+
+	// Tick interval for the movement component, camera, motion controllers and parent relative attachment, 0 is every frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterSignificance", meta = (ClampMin = "0.0", UIMin = "0"))
+		float TickInterval;
+
+	// If true the motion controllers will snap to replicated transforms instead of smoothing between them
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterSignificance")
+		bool bDisableHandSmoothing;
+
+	// If true the replicated camera will snap to replicated transforms instead of smoothing between them
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterSignificance")
+		bool bDisableCameraSmoothing;
+
+	// If true the parent relative attachment will stop following the HMD yaw and only update its location
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterSignificance")
+		bool bDisableParentRelativeYaw;
+
+	// If true the motion controllers will skip late update primitive gathering
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterSignificance")
+		bool bDisableLateUpdates;
+
+	FBPVRCharacterSignificanceTier() :
+		MaxDistance(0.0f),
+		TickInterval(0.0f),
+		bDisableHandSmoothing(false),
+		bDisableCameraSmoothing(false),
+		bDisableParentRelativeYaw(false),
+		bDisableLateUpdates(false)
+	{}
+
+	FBPVRCharacterSignificanceTier(float MaxDistanceIn, float TickIntervalIn, bool bDisableHandSmoothingIn, bool bDisableCameraSmoothingIn, bool bDisableParentRelativeYawIn, bool bDisableLateUpdatesIn) :
+		MaxDistance(MaxDistanceIn),
+		TickInterval(TickIntervalIn),
+		bDisableHandSmoothing(bDisableHandSmoothingIn),
+		bDisableCameraSmoothing(bDisableCameraSmoothingIn),
+		bDisableParentRelativeYaw(bDisableParentRelativeYawIn),
+		bDisableLateUpdates(bDisableLateUpdatesIn)
+	{}
+};
+
 UCLASS(config = Engine, defaultconfig)
 class VREXPANSIONPLUGIN_API UVRGlobalSettings : public UObject
 {
@@ -142,10 +193,46 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "GunSettings|Secondary Grip 1Euro Settings")
 		float OneEuroDeltaCutoff;
 
+	// If true remote (simulated proxy) VR characters will have their tick rates and non essential work scaled down
+	// by distance and visibility through the VRCharacterSignificanceSubsystem
+	UPROPERTY(config, EditAnywhere, Category = "CharacterSignificance")
+		bool bUseVRCharacterSignificance;
+
+	// How often in seconds to re-evaluate the significance of remote VR characters
+	UPROPERTY(config, EditAnywhere, Category = "CharacterSignificance", meta = (ClampMin = "0.0", UIMin = "0"))
+		float CharacterSignificanceUpdateInterval;
+
+	// Percentage of a tiers MaxDistance that a character has to move past before dropping to a lower tier, prevents flip flopping on the edges
+	UPROPERTY(config, EditAnywhere, Category = "CharacterSignificance", meta = (ClampMin = "0.0", UIMin = "0", ClampMax = "1.0", UIMax = "1.0"))
+		float CharacterSignificanceHysteresis;
+
+	// If true characters that have not been rendered recently are pushed down one tier
+	UPROPERTY(config, EditAnywhere, Category = "CharacterSignificance")
+		bool bDemoteOffScreenCharacters;
+
+	// Tiers in order of most to least significant, characters past the last tiers distance use the last tier
+	UPROPERTY(config, EditAnywhere, Category = "CharacterSignificance")
+		TArray<FBPVRCharacterSignificanceTier> CharacterSignificanceTiers;
+
+	// If true levers, dials, sliders and buttons are updated in a single batched pass by the UVRInteractibleUpdateSubsystem
+	// while they are active instead of each enabling their own component tick. The pass runs after TG_PostPhysics instead of in TG_DuringPhysics.
+	UPROPERTY(config, EditAnywhere, Category = "Interactibles")
+		bool bUseBatchedInteractibleUpdates;
+
 	// Get the values of the virtual stock settings
 	UFUNCTION(BlueprintCallable, Category = "MeleeSettings")
 		static void GetMeleeSurfaceGlobalSettings(TArray<FBPHitSurfaceProperties>& OutMeleeSurfaceSettings);
 
+	// Lookup table of the MeleeSurfaceSettings shared by all melee scripts that don't override them, built on first use
+	static const FBPHitSurfaceLookupTable& GetMeleeSurfaceGlobalLookupTable();
+
+	// Rebuilds the shared melee surface lookup table, call this if you alter the MeleeSurfaceSettings during play
+	UFUNCTION(BlueprintCallable, Category = "MeleeSettings")
+		static void RebuildMeleeSurfaceGlobalLookupTable();
+
+	FBPHitSurfaceLookupTable MeleeSurfaceLookupTable;
+	bool bMeleeSurfaceLookupTableBuilt;
+
 	// Get the values of the virtual stock settings
 	UFUNCTION(BlueprintCallable, Category = "GunSettings|VirtualStock")
 		static void GetVirtualStockGlobalSettings(FBPVirtualStockSettings& OutVirtualStockSettings);
@@ -236,4 +323,8 @@ public:
 		static bool LoadControllerProfile(const FBPVRControllerProfile& ControllerProfile, bool bSetAsCurrentProfile = true);
 
 	virtual void PostInitProperties() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
@@ -10,6 +10,50 @@
 
 #include "VRGripInterface.generated.h"
 
+// Packed copy of the interface values the grip controller reads when starting and checking grips.
+// Native grippables fill it straight from their VRGripInterfaceSettings, Blueprint implementers and Blueprint overrides go through the interface events.
+struct VREXPANSIONPLUGIN_API FVRGripInterfaceSnapshot
+{
+	EGripCollisionType PrimaryGripType;
+	EGripLateUpdateSettings LateUpdateSetting;
+	EGripMovementReplicationSettings MovementReplicationType;
+	float ConstraintStiffness;
+	float ConstraintDamping;
+	float ConstraintBreakDistance;
+
+	// Points into the implementers settings when filled with FillFrom, null when the values were returned by value
+	const FBPAdvGripSettings* AdvancedGripSettingsPtr;
+
+	// Holds the advanced settings returned by the interface event or its native implementation
+	FBPAdvGripSettings StoredAdvancedGripSettings;
+
+	FVRGripInterfaceSnapshot() :
+		PrimaryGripType(EGripCollisionType::InteractiveCollisionWithPhysics),
+		LateUpdateSetting(EGripLateUpdateSettings::NotWhenCollidingOrDoubleGripping),
+		MovementReplicationType(EGripMovementReplicationSettings::ForceClientSideMovement),
+		ConstraintStiffness(0.0f),
+		ConstraintDamping(0.0f),
+		ConstraintBreakDistance(0.0f),
+		AdvancedGripSettingsPtr(nullptr)
+	{}
+
+	FORCEINLINE void FillFrom(const FBPInterfaceProperties& Settings, bool bIsSlot)
+	{
+		PrimaryGripType = bIsSlot ? Settings.SlotDefaultGripType : Settings.FreeDefaultGripType;
+		LateUpdateSetting = Settings.LateUpdateSetting;
+		MovementReplicationType = Settings.MovementReplicationType;
+		ConstraintStiffness = Settings.ConstraintStiffness;
+		ConstraintDamping = Settings.ConstraintDamping;
+		ConstraintBreakDistance = Settings.ConstraintBreakDistance;
+		AdvancedGripSettingsPtr = &Settings.AdvancedGripSettings;
+	}
+
+	FORCEINLINE const FBPAdvGripSettings& GetAdvancedGripSettings() const
+	{
+		return AdvancedGripSettingsPtr ? *AdvancedGripSettingsPtr : StoredAdvancedGripSettings;
+	}
+};
+
 
 UINTERFACE(Blueprintable)
 class VREXPANSIONPLUGIN_API UVRGripInterface: public UInterface
@@ -30,6 +74,22 @@ class VREXPANSIONPLUGIN_API IVRGripInterface
  
 public:
 
+	// Native fast path for the grip controller, by default calls the native _Implementation of each event directly.
+	// This skips ProcessEvent but still picks up C++ overrides of them. Classes that never override the events can
+	// instead fill it in place from their settings with FVRGripInterfaceSnapshot::FillFrom, return false to force the events.
+	virtual bool GetNativeGripInterfaceSnapshot(bool bIsSlot, FVRGripInterfaceSnapshot& OutSnapshot);
+
+	// Gets the grip interface values of an object, skips the interface events when the object is native
+	// and its class doesn't override any of them in Blueprint.
+	static void GetGripInterfaceSnapshot(UObject* Object, bool bIsSlot, FVRGripInterfaceSnapshot& OutSnapshot);
+
+	// Only the native fast path, returns false without calling any events if it isn't available.
+	// For per frame reads of a single value where a full event fallback would cost more than the one event.
+	static bool TryGetNativeGripInterfaceSnapshot(UObject* Object, bool bIsSlot, FVRGripInterfaceSnapshot& OutSnapshot);
+
+	// If the class overrides any of the snapshot events in Blueprint, cached per class
+	static bool HasBlueprintSnapshotOverrides(UClass* Class);
+
 	// Set up as deny instead of allow so that default allows for gripping
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "VRGripInterface", meta = (DisplayName = "IsDenyingGrips"))
 		bool DenyGripping();